@@ -12,6 +12,7 @@ ActuatorForcing::ActuatorForcing(const CFDSim& sim)
     if (!sim.physics_manager().contains("Actuator")) {
         amrex::Abort("ActuatorForcing requires Actuator physics to be active");
     }
+    m_actuator = &(sim.physics_manager().get<actuator::Actuator>());
 }
 
 ActuatorForcing::~ActuatorForcing() = default;
@@ -23,6 +24,11 @@ void ActuatorForcing::operator()(
     const FieldState /*fstate*/,
     const amrex::Array4<amrex::Real>& src_term) const
 {
+    // Skip boxes that are not influenced by any actuator
+    if (!m_actuator->has_source(lev, mfi.index())) {
+        return;
+    }
+
     const auto varr = m_act_src(lev).const_array(mfi);
 
     amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
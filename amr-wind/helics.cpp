@@ -92,8 +92,7 @@ HelicsStorage::HelicsStorage(CFDSim& sim) : m_sim(sim)
         m_num_turbines = actuators.size();
     }
 
-    m_turbine_power_to_controller.resize(m_num_turbines, 0.0);
-    m_turbine_wind_direction_to_controller.resize(m_num_turbines, 0.0);
+    m_turbine_telemetry.resize(m_num_turbines);
     m_turbine_yaw_to_amrwind.resize(m_num_turbines, 270.0);
 
 #endif
@@ -211,15 +210,14 @@ void HelicsStorage::recv_messages_from_controller()
             ssToControlCenter << "[" << m_sim.time().current_time() << ", "
                               << wind_speed << " , " << wind_direction;
 
-            for (int yy = 0; yy < m_turbine_power_to_controller.size(); yy++) {
+            for (const auto& telemetry : m_turbine_telemetry) {
                 ssToControlCenter << ",";
-                ssToControlCenter << m_turbine_power_to_controller[yy];
+                ssToControlCenter << telemetry.power;
             }
 
-            for (int yy = 0; yy < m_turbine_wind_direction_to_controller.size();
-                 yy++) {
+            for (const auto& telemetry : m_turbine_telemetry) {
                 ssToControlCenter << ",";
-                ssToControlCenter << m_turbine_wind_direction_to_controller[yy];
+                ssToControlCenter << telemetry.wind_direction;
             }
 
             ssToControlCenter << "]";
@@ -228,7 +226,7 @@ void HelicsStorage::recv_messages_from_controller()
             strToControlCenter = ssToControlCenter.str();
             pub.publish(strToControlCenter.c_str());
 
-            amrex::Print() << "\n should send m_turbine_power_to_controller "
+            amrex::Print() << "\n should send m_turbine_telemetry "
                            << strToControlCenter.c_str() << std::endl;
         }
     }
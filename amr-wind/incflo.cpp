@@ -335,14 +335,29 @@ void incflo::Evolve()
                       "========================\n"
                    << std::endl;
 
-    // Output at final time
+    write_final_output();
+}
+
+/** Perform the outputs at the final time
+ *
+ *  The outputs buffered in memory by the physics and post-processing
+ *  utilities are written before the last plot file and checkpoint so that
+ *  they are consistent with the last checkpoint.
+ */
+void incflo::write_final_output()
+{
+    BL_PROFILE("amr-wind::incflo::write_final_output");
+    for (auto& pp : m_sim.physics()) {
+        pp->flush_outputs();
+    }
+    m_sim.post_manager().final_output();
+
     if (m_time.write_last_plot_file()) {
         m_sim.io_manager().write_plot_file();
     }
     if (m_time.write_last_checkpoint()) {
         m_sim.io_manager().write_checkpoint_file();
     }
-    m_sim.post_manager().final_output();
 }
 
 void incflo::do_advance(const int fixed_point_iteration)
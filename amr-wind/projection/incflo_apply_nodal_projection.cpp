@@ -22,7 +22,7 @@ void amr_wind::nodal_projection::set_inflow_velocity(
     // TODO fix hack for ABL
     if (phy_mgr.contains("ABL")) {
         auto& abl = phy_mgr.get<amr_wind::ABL>();
-        const auto& bndry_plane = abl.bndry_plane();
+        auto& bndry_plane = abl.bndry_plane();
         bndry_plane.populate_data(lev, time, vel_fld, vel_mfab);
         abl.abl_mpl().set_velocity(lev, time, vel_fld, vel_mfab);
     }
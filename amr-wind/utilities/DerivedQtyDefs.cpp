@@ -5,6 +5,38 @@
 
 namespace amr_wind::derived {
 
+namespace {
+
+/** Evaluate a function of the velocity gradient tensor at a list of cells
+ *
+ *  The velocity field needs two ghost cells so that the stencil can be
+ *  applied in the ghost cells of the tile.
+ */
+template <typename Func>
+void velocity_gradient_cells(
+    const Field& vel,
+    const int lev,
+    const amrex::MFIter& mfi,
+    const amrex::IntVect* cells,
+    const int ncells,
+    amrex::Real* out,
+    const int stride,
+    const int scomp,
+    Func func)
+{
+    const auto& geom = vel.repo().mesh().Geom(lev);
+    const auto idx = geom.InvCellSizeArray();
+    const auto ds = fvm::pointwise::domain_stencil(geom);
+    const auto vel_arr = vel(lev).const_array(mfi);
+    amrex::ParallelFor(ncells, [=] AMREX_GPU_DEVICE(const int n) noexcept {
+        const auto grad =
+            fvm::pointwise::velocity_gradient(vel_arr, cells[n], ds, idx);
+        out[n * stride + scomp] = func(grad);
+    });
+}
+
+} // namespace
+
 VorticityMag::VorticityMag(
     const FieldRepo& repo, const std::vector<std::string>& args)
     : m_vel(repo.get_field("velocity"))
@@ -20,6 +52,29 @@ void VorticityMag::operator()(ScratchField& fld, const int scomp) const
     fvm::vorticity_mag(vort_mag, m_vel);
 }
 
+bool VorticityMag::has_cell_evaluation() const
+{
+    return m_vel.num_grow() > amrex::IntVect(1);
+}
+
+void VorticityMag::evaluate_cells(
+    const int lev,
+    const amrex::MFIter& mfi,
+    const amrex::IntVect* cells,
+    const int ncells,
+    amrex::Real* out,
+    const int stride,
+    const int scomp) const
+{
+    velocity_gradient_cells(
+        m_vel, lev, mfi, cells, ncells, out, stride, scomp,
+        [] AMREX_GPU_DEVICE(const amrex::GpuArray<amrex::Real, 9>& g) {
+            return std::sqrt(
+                (g[1] - g[3]) * (g[1] - g[3]) + (g[5] - g[7]) * (g[5] - g[7]) +
+                (g[6] - g[2]) * (g[6] - g[2]));
+        });
+}
+
 QCriterion::QCriterion(
     const FieldRepo& repo, const std::vector<std::string>& args)
     : m_vel(repo.get_field("velocity"))
@@ -35,6 +90,35 @@ void QCriterion::operator()(ScratchField& fld, const int scomp) const
     fvm::q_criterion(q_crit, m_vel);
 }
 
+bool QCriterion::has_cell_evaluation() const
+{
+    return m_vel.num_grow() > amrex::IntVect(1);
+}
+
+void QCriterion::evaluate_cells(
+    const int lev,
+    const amrex::MFIter& mfi,
+    const amrex::IntVect* cells,
+    const int ncells,
+    amrex::Real* out,
+    const int stride,
+    const int scomp) const
+{
+    velocity_gradient_cells(
+        m_vel, lev, mfi, cells, ncells, out, stride, scomp,
+        [] AMREX_GPU_DEVICE(const amrex::GpuArray<amrex::Real, 9>& g) {
+            const amrex::Real S2 =
+                g[0] * g[0] + g[4] * g[4] + g[8] * g[8] +
+                0.5 * (g[1] + g[3]) * (g[1] + g[3]) +
+                0.5 * (g[5] + g[7]) * (g[5] + g[7]) +
+                0.5 * (g[6] + g[2]) * (g[6] + g[2]);
+            const amrex::Real W2 = 0.5 * (g[1] - g[3]) * (g[1] - g[3]) +
+                                   0.5 * (g[5] - g[7]) * (g[5] - g[7]) +
+                                   0.5 * (g[6] - g[2]) * (g[6] - g[2]);
+            return 0.5 * (W2 - S2);
+        });
+}
+
 QCriterionNondim::QCriterionNondim(
     const FieldRepo& repo, const std::vector<std::string>& args)
     : m_vel(repo.get_field("velocity"))
@@ -50,6 +134,35 @@ void QCriterionNondim::operator()(ScratchField& fld, const int scomp) const
     fvm::q_criterion(q_crit_nd, m_vel, true);
 }
 
+bool QCriterionNondim::has_cell_evaluation() const
+{
+    return m_vel.num_grow() > amrex::IntVect(1);
+}
+
+void QCriterionNondim::evaluate_cells(
+    const int lev,
+    const amrex::MFIter& mfi,
+    const amrex::IntVect* cells,
+    const int ncells,
+    amrex::Real* out,
+    const int stride,
+    const int scomp) const
+{
+    velocity_gradient_cells(
+        m_vel, lev, mfi, cells, ncells, out, stride, scomp,
+        [] AMREX_GPU_DEVICE(const amrex::GpuArray<amrex::Real, 9>& g) {
+            const amrex::Real S2 =
+                g[0] * g[0] + g[4] * g[4] + g[8] * g[8] +
+                0.5 * (g[1] + g[3]) * (g[1] + g[3]) +
+                0.5 * (g[5] + g[7]) * (g[5] + g[7]) +
+                0.5 * (g[6] + g[2]) * (g[6] + g[2]);
+            const amrex::Real W2 = 0.5 * (g[1] - g[3]) * (g[1] - g[3]) +
+                                   0.5 * (g[5] - g[7]) * (g[5] - g[7]) +
+                                   0.5 * (g[6] - g[2]) * (g[6] - g[2]);
+            return 0.5 * (W2 / amrex::max(1e-14, S2) - 1.0);
+        });
+}
+
 StrainRateMag::StrainRateMag(
     const FieldRepo& repo, const std::vector<std::string>& args)
     : m_vel(repo.get_field("velocity"))
@@ -65,6 +178,30 @@ void StrainRateMag::operator()(ScratchField& fld, const int scomp) const
     fvm::strainrate(srate, m_vel);
 }
 
+bool StrainRateMag::has_cell_evaluation() const
+{
+    return m_vel.num_grow() > amrex::IntVect(1);
+}
+
+void StrainRateMag::evaluate_cells(
+    const int lev,
+    const amrex::MFIter& mfi,
+    const amrex::IntVect* cells,
+    const int ncells,
+    amrex::Real* out,
+    const int stride,
+    const int scomp) const
+{
+    velocity_gradient_cells(
+        m_vel, lev, mfi, cells, ncells, out, stride, scomp,
+        [] AMREX_GPU_DEVICE(const amrex::GpuArray<amrex::Real, 9>& g) {
+            return std::sqrt(
+                2.0 * g[0] * g[0] + 2.0 * g[4] * g[4] + 2.0 * g[8] * g[8] +
+                (g[1] + g[3]) * (g[1] + g[3]) + (g[5] + g[7]) * (g[5] + g[7]) +
+                (g[6] + g[2]) * (g[6] + g[2]));
+        });
+}
+
 Gradient::Gradient(const FieldRepo& repo, const std::vector<std::string>& args)
 {
     AMREX_ALWAYS_ASSERT(args.size() == 1U);
@@ -79,6 +216,34 @@ void Gradient::operator()(ScratchField& fld, const int scomp) const
     fvm::gradient(gradphi, *m_phi);
 }
 
+bool Gradient::has_cell_evaluation() const
+{
+    return m_phi->num_grow() > amrex::IntVect(1);
+}
+
+void Gradient::evaluate_cells(
+    const int lev,
+    const amrex::MFIter& mfi,
+    const amrex::IntVect* cells,
+    const int ncells,
+    amrex::Real* out,
+    const int stride,
+    const int scomp) const
+{
+    const auto& geom = m_phi->repo().mesh().Geom(lev);
+    const auto idx = geom.InvCellSizeArray();
+    const auto ds = fvm::pointwise::domain_stencil(geom);
+    const auto phi_arr = (*m_phi)(lev).const_array(mfi);
+    const int ncomp = m_phi->num_comp();
+    amrex::ParallelFor(ncells, [=] AMREX_GPU_DEVICE(const int n) noexcept {
+        for (int icomp = 0; icomp < ncomp; ++icomp) {
+            fvm::pointwise::gradient(
+                phi_arr, cells[n], icomp, ds, idx,
+                &out[n * stride + scomp + icomp * AMREX_SPACEDIM]);
+        }
+    });
+}
+
 Divergence::Divergence(
     const FieldRepo& repo, const std::vector<std::string>& args)
 {
@@ -95,6 +260,27 @@ void Divergence::operator()(ScratchField& fld, const int scomp) const
     fvm::divergence(divphi, *m_phi);
 }
 
+bool Divergence::has_cell_evaluation() const
+{
+    return m_phi->num_grow() > amrex::IntVect(1);
+}
+
+void Divergence::evaluate_cells(
+    const int lev,
+    const amrex::MFIter& mfi,
+    const amrex::IntVect* cells,
+    const int ncells,
+    amrex::Real* out,
+    const int stride,
+    const int scomp) const
+{
+    velocity_gradient_cells(
+        *m_phi, lev, mfi, cells, ncells, out, stride, scomp,
+        [] AMREX_GPU_DEVICE(const amrex::GpuArray<amrex::Real, 9>& g) {
+            return g[0] + g[4] + g[8];
+        });
+}
+
 Laplacian::Laplacian(
     const FieldRepo& repo, const std::vector<std::string>& args)
 {
@@ -147,4 +333,29 @@ void FieldComponents::operator()(ScratchField& fld, const int scomp) const
     }
 }
 
+bool FieldComponents::has_cell_evaluation() const
+{
+    return m_fld->num_grow() > amrex::IntVect(0);
+}
+
+void FieldComponents::evaluate_cells(
+    const int lev,
+    const amrex::MFIter& mfi,
+    const amrex::IntVect* cells,
+    const int ncells,
+    amrex::Real* out,
+    const int stride,
+    const int scomp) const
+{
+    const auto fld_arr = (*m_fld)(lev).const_array(mfi);
+    for (int n = 0; n < m_ncomp; ++n) {
+        const int icomp = m_comp[n];
+        const int dst_comp = scomp + n;
+        amrex::ParallelFor(
+            ncells, [=] AMREX_GPU_DEVICE(const int ic) noexcept {
+                out[ic * stride + dst_comp] = fld_arr(cells[ic], icomp);
+            });
+    }
+}
+
 } // namespace amr_wind::derived
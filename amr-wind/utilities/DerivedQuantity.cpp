@@ -55,6 +55,19 @@ void DerivedQty::var_names(amrex::Vector<std::string>& plt_var_names)
     ioutils::add_var_names(plt_var_names, this->name(), this->num_comp());
 }
 
+void DerivedQty::evaluate_cells(
+    const int /*lev*/,
+    const amrex::MFIter& /*mfi*/,
+    const amrex::IntVect* /*cells*/,
+    const int /*ncells*/,
+    amrex::Real* /*out*/,
+    const int /*stride*/,
+    const int /*scomp*/) const
+{
+    amrex::Abort(
+        "DerivedQty: cell evaluation is not supported for " + this->name());
+}
+
 DerivedQtyMgr::DerivedQtyMgr(const FieldRepo& repo) : m_repo(repo) {}
 
 DerivedQty& DerivedQtyMgr::create(const std::string& key)
@@ -102,6 +115,30 @@ int DerivedQtyMgr::num_comp() const noexcept
         });
 }
 
+bool DerivedQtyMgr::has_cell_evaluation() const noexcept
+{
+    return std::all_of(
+        m_derived_vec.begin(), m_derived_vec.end(),
+        [](const std::unique_ptr<DerivedQty>& qty) {
+            return qty->has_cell_evaluation();
+        });
+}
+
+void DerivedQtyMgr::evaluate_cells(
+    const int lev,
+    const amrex::MFIter& mfi,
+    const amrex::IntVect* cells,
+    const int ncells,
+    amrex::Real* out) const
+{
+    const int stride = num_comp();
+    int icomp = 0;
+    for (const auto& qty : m_derived_vec) {
+        qty->evaluate_cells(lev, mfi, cells, ncells, out, stride, icomp);
+        icomp += qty->num_comp();
+    }
+}
+
 bool DerivedQtyMgr::contains(const std::string& key) const noexcept
 {
     auto it = m_obj_map.find(key);
@@ -90,6 +90,7 @@ void PostProcessManager::final_output()
                 m_sim.time().delta_t(), tol)) {
             post->output_actions();
         }
+        post->flush_outputs();
     }
 }
 
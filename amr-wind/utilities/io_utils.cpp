@@ -2,6 +2,8 @@
 
 #include "amr-wind/utilities/io_utils.H"
 
+#include "AMReX_ParmParse.H"
+
 namespace amr_wind::ioutils {
 
 void goto_next_line(std::istream& is)
@@ -56,4 +58,23 @@ void read_flat_grid_file(
 
     file.close();
 }
+
+void query_netcdf_options(
+    const amrex::ParmParse& pp,
+    const std::string& prefix,
+    ncutils::NCVarOptions& opts)
+{
+    pp.query((prefix + "netcdf_deflate_level").c_str(), opts.deflate_level);
+    pp.query((prefix + "netcdf_shuffle").c_str(), opts.shuffle);
+    pp.query(
+        (prefix + "netcdf_single_precision").c_str(), opts.single_precision);
+    int record_chunk = static_cast<int>(opts.record_chunk);
+    pp.query((prefix + "netcdf_record_chunk").c_str(), record_chunk);
+    assert_with_message(
+        (opts.deflate_level >= 0) && (opts.deflate_level <= 9),
+        "NetCDF deflate level must be between 0 and 9");
+    assert_with_message(
+        record_chunk >= 0, "NetCDF record chunk must be non-negative");
+    opts.record_chunk = static_cast<size_t>(record_chunk);
+}
 } // namespace amr_wind::ioutils
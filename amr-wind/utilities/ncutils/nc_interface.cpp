@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <cstdio>
 
 #include "amr-wind/utilities/ncutils/nc_interface.H"
@@ -19,6 +20,27 @@ void check_nc_error(int ierr)
         abort_func("Encountered NetCDF error; aborting");
     }
 }
+
+//! Check if a dimension is unlimited in a group or any of its ancestors
+bool is_unlimited_dim(const int ncid, const int dimid)
+{
+    int gid = ncid;
+    while (true) {
+        int nunlim;
+        check_nc_error(nc_inq_unlimdims(gid, &nunlim, nullptr));
+        std::vector<int> unlimids(nunlim);
+        check_nc_error(nc_inq_unlimdims(gid, &nunlim, unlimids.data()));
+        if (std::find(unlimids.begin(), unlimids.end(), dimid) !=
+            unlimids.end()) {
+            return true;
+        }
+        int parent;
+        if (nc_inq_grp_parent(gid, &parent) != NC_NOERR) {
+            return false;
+        }
+        gid = parent;
+    }
+}
 } // namespace
 
 std::string NCDim::name() const
@@ -355,6 +377,53 @@ NCVar NCGroup::def_array(
     return NCVar{ncid, newid};
 }
 
+NCVar NCGroup::def_array(
+    const std::string& name,
+    const nc_type dtype,
+    const std::vector<std::string>& dnames,
+    const NCVarOptions& opts) const
+{
+    const nc_type stype =
+        (opts.single_precision && (dtype == NC_DOUBLE)) ? NC_FLOAT : dtype;
+    auto var = def_array(name, stype, dnames);
+
+    const auto ndims = dnames.size();
+    std::vector<size_t> chunks(opts.chunks);
+    const bool custom_records =
+        (opts.record_chunk > 0) || (opts.deflate_level > 0);
+    if (chunks.empty() && (ndims > 0) && custom_records) {
+        if (is_unlimited_dim(ncid, dim(dnames[0]).dimid)) {
+            chunks.resize(ndims);
+            size_t record_size;
+            check_nc_error(nc_inq_type(ncid, stype, nullptr, &record_size));
+            for (size_t i = 1; i < ndims; ++i) {
+                chunks[i] = std::max<size_t>(dim(dnames[i]).len(), 1);
+                record_size *= chunks[i];
+            }
+            constexpr size_t chunk_bytes = 64 * 1024;
+            constexpr size_t max_records = 1024;
+            chunks[0] = (opts.record_chunk > 0)
+                            ? opts.record_chunk
+                            : std::clamp<size_t>(
+                                  chunk_bytes / record_size, 1, max_records);
+        }
+    }
+
+    if (!chunks.empty()) {
+        if (chunks.size() != ndims) {
+            abort_func("NetCDF: Invalid chunk shape for variable " + name);
+        }
+        check_nc_error(
+            nc_def_var_chunking(ncid, var.varid, NC_CHUNKED, chunks.data()));
+    }
+
+    if (opts.deflate_level > 0) {
+        check_nc_error(nc_def_var_deflate(
+            ncid, var.varid, opts.shuffle ? 1 : 0, 1, opts.deflate_level));
+    }
+    return var;
+}
+
 NCVar NCGroup::var(const std::string& name) const
 {
     int varid;
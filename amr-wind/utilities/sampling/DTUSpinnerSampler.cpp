@@ -240,6 +240,12 @@ void DTUSpinnerSampler::get_turbine_data(const std::string& turbine_label)
         const auto& actdata = actline->meta().fast_data;
         const auto& info = actline->info();
 
+        // The hub state is updated by the OpenFAST step running in the
+        // background
+        if (info.is_root_proc && (actline->meta().fast != nullptr)) {
+            actline->meta().fast->wait_turbines();
+        }
+
         // Create buffer object
         amrex::Array<double, 18> turbine_pack = {};
 
@@ -258,6 +264,12 @@ void DTUSpinnerSampler::get_turbine_data(const std::string& turbine_label)
         const auto& actdata = actdisk->meta().fast_data;
         const auto& info = actdisk->info();
 
+        // The hub state is updated by the OpenFAST step running in the
+        // background
+        if (info.is_root_proc && (actdisk->meta().fast != nullptr)) {
+            actdisk->meta().fast->wait_turbines();
+        }
+
         // Create buffer object
         amrex::Array<double, 18> turbine_pack = {};
 
@@ -339,7 +339,60 @@ void FreeSurfaceSampler::initialize(const std::string& key)
                 });
         }
     }
+
+    build_column_index();
+}
+
+void FreeSurfaceSampler::build_column_index()
+{
+    BL_PROFILE("amr-wind::FreeSurfaceSampler::build_column_index");
+
+    auto& fidx = m_sim.repo().get_int_field("sample_idx_" + m_label);
+    const int nlevels = m_vof.repo().num_active_levels();
+    m_column_boxes.resize(nlevels);
+    m_box_phase.resize(nlevels);
+    for (int lev = 0; lev < nlevels; ++lev) {
+        const auto nboxes = fidx(lev).boxArray().size();
+        m_column_boxes[lev].assign(nboxes, 0);
+        m_box_phase[lev].assign(nboxes, BoxPhase::interface);
+        for (amrex::MFIter mfi(fidx(lev)); mfi.isValid(); ++mfi) {
+            // The first component holds a sample index in every cell that
+            // contains at least one sampler column
+            const int max_idx =
+                fidx(lev)[mfi].max<amrex::RunOn::Device>(mfi.validbox(), 0);
+            m_column_boxes[lev][mfi.index()] = (max_idx >= 0) ? 1 : 0;
+        }
+    }
+}
+
+void FreeSurfaceSampler::update_interface_band()
+{
+    BL_PROFILE("amr-wind::FreeSurfaceSampler::update_interface_band");
+
+    const int nlevels = m_vof.repo().num_active_levels();
+    for (int lev = 0; lev < nlevels; ++lev) {
+        for (amrex::MFIter mfi(m_vof(lev)); mfi.isValid(); ++mfi) {
+            if (m_column_boxes[lev][mfi.index()] == 0) {
+                continue;
+            }
+            // Include the neighbor cells in the search direction, where the
+            // interface can be located at a face of the box
+            const auto bx = amrex::grow(mfi.validbox(), m_coorddir, 1);
+            const auto& vof = m_vof(lev)[mfi];
+            const amrex::Real vmin = vof.min<amrex::RunOn::Device>(bx, 0);
+            const amrex::Real vmax = vof.max<amrex::RunOn::Device>(bx, 0);
+            auto& phase = m_box_phase[lev][mfi.index()];
+            if (vmin >= 1.0 - 1e-12) {
+                phase = BoxPhase::full;
+            } else if (vmax <= 1e-12) {
+                phase = BoxPhase::empty;
+            } else {
+                phase = BoxPhase::interface;
+            }
+        }
+    }
 }
+
 void FreeSurfaceSampler::check_bounds()
 {
     const int lev = 0;
@@ -414,10 +467,6 @@ bool FreeSurfaceSampler::update_sampling_locations()
 
     BL_PROFILE("amr-wind::FreeSurfaceSampler::update_sampling_locations");
 
-    // Zero data in output array
-    for (int n = 0; n < m_npts * m_ninst; n++) {
-        m_out[n] = 0.0;
-    }
     // Set up device vector of current outputs, initialize to plo
     const auto& plo0 = m_sim.mesh().Geom(0).ProbLoArray();
     amrex::Gpu::DeviceVector<amrex::Real> dout(m_npts, plo0[m_coorddir]);
@@ -440,6 +489,12 @@ bool FreeSurfaceSampler::update_sampling_locations()
     const int gc1 = m_gc1;
     const int ncomp = m_ncomp;
 
+#ifdef AMREX_USE_GPU
+    const bool reduce_on_device = amrex::ParallelDescriptor::UseGpuAwareMpi();
+#else
+    const bool reduce_on_device = true;
+#endif
+
     bool use_linear = m_use_linear;
     const amrex::Real lx_linear = m_lx_linear;
     bool has_overset = m_sim.has_overset();
@@ -448,8 +503,18 @@ bool FreeSurfaceSampler::update_sampling_locations()
         iblank_ptr = &m_sim.repo().get_int_field("iblank_cell");
     }
 
+    // Only boxes that hold sampler columns and are not filled with a single
+    // phase need to be searched for the interface
+    update_interface_band();
+
     // Loop instances
     for (int ni = 0; ni < m_ninst; ++ni) {
+        // Boxes filled with the phase above the interface do not contain it.
+        // For the first instance, boxes filled with the phase below the
+        // interface are bounded by the cells above them, unless they are at
+        // the top of the domain.
+        const auto phase_above =
+            (ni % 2 == 0) ? BoxPhase::empty : BoxPhase::full;
         for (int lev = 0; lev <= finest_level; lev++) {
             // Level mask info is built into idx info
 
@@ -462,16 +527,25 @@ bool FreeSurfaceSampler::update_sampling_locations()
             const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> plo =
                 geom.ProbLoArray();
             const amrex::Real xhi = geom.ProbHi(0);
+            const int dom_hi = geom.Domain().bigEnd(dir);
 #ifdef AMREX_USE_OMP
 #pragma omp parallel if (false)
 #endif
             for (amrex::MFIter mfi(floc(lev)); mfi.isValid(); ++mfi) {
+                const auto& vbx = mfi.validbox();
+                const auto phase = m_box_phase[lev][mfi.index()];
+                const bool below_only = (ni == 0) &&
+                                        (phase == BoxPhase::full) &&
+                                        (vbx.bigEnd(dir) < dom_hi);
+                if ((m_column_boxes[lev][mfi.index()] == 0) ||
+                    (phase == phase_above) || below_only) {
+                    continue;
+                }
                 auto loc_arr = floc(lev).const_array(mfi);
                 auto idx_arr = fidx(lev).const_array(mfi);
                 auto vof_arr = m_vof(lev).const_array(mfi);
                 auto ibl_arr = has_overset ? (*iblank_ptr)(lev).const_array(mfi)
                                            : amrex::Array4<int>();
-                const auto& vbx = mfi.validbox();
                 amrex::ParallelFor(
                     vbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
                         // Cell location
@@ -683,18 +757,35 @@ bool FreeSurfaceSampler::update_sampling_locations()
             }
         }
 
-        // Copy information back from device
-        amrex::Gpu::copy(
-            amrex::Gpu::deviceToHost, dout.begin(), dout.end(),
-            &m_out[static_cast<long>(ni) * m_npts]);
-        // Make consistent across parallelization
-        for (int n = 0; n < m_npts; n++) {
-            amrex::ParallelDescriptor::ReduceRealMax(m_out[ni * m_npts + n]);
+        // Make consistent across parallelization with a single reduction for
+        // all the points of this instance. When MPI can access device memory,
+        // the device vector is reduced in place and only copied to the host
+        // for output.
+        auto* out_ptr = &m_out[static_cast<long>(ni) * m_npts];
+        const bool last_instance = (ni == m_ninst - 1);
+        if (reduce_on_device) {
+            amrex::Gpu::streamSynchronize();
+            amrex::ParallelDescriptor::ReduceRealMax(dout_ptr, m_npts);
+            if (!last_instance) {
+                amrex::Gpu::copy(
+                    amrex::Gpu::deviceToDevice, dout.begin(), dout.end(),
+                    dout_last.begin());
+            }
+            amrex::Gpu::copy(
+                amrex::Gpu::deviceToHost, dout.begin(), dout.end(), out_ptr);
+        } else {
+            amrex::Gpu::copy(
+                amrex::Gpu::deviceToHost, dout.begin(), dout.end(), out_ptr);
+            amrex::ParallelDescriptor::ReduceRealMax(out_ptr, m_npts);
+            if (!last_instance) {
+                amrex::Gpu::copy(
+                    amrex::Gpu::hostToDevice, out_ptr, out_ptr + m_npts,
+                    dout_last.begin());
+            }
+        }
+        if (last_instance) {
+            break;
         }
-        // Copy last m_out to device vector of results of last instance
-        amrex::Gpu::copy(
-            amrex::Gpu::hostToDevice, &m_out[static_cast<long>(ni) * m_npts],
-            &m_out[(ni + 1) * m_npts - 1] + 1, dout_last.begin());
         // Reset current output device vector
         const auto coorddir = m_coorddir;
         amrex::ParallelFor(m_npts, [=] AMREX_GPU_DEVICE(int n) {
@@ -849,6 +940,8 @@ void FreeSurfaceSampler::post_regrid_actions()
                 });
         }
     }
+
+    build_column_index();
 }
 
 #ifdef AMR_WIND_USE_NETCDF
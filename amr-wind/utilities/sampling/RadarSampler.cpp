@@ -205,8 +205,10 @@ bool RadarSampler::update_sampling_locations()
 
     m_ns = int(dt_sim / dt_sample) + time_corr;
 
-    m_los_unit.resize(m_ntotal * num_points_quad());
-    m_los_proj.resize(m_ntotal * num_points_quad());
+    const amrex::Long nquad = num_points_quad();
+    m_los_unit.resize(m_ntotal * nquad);
+    m_los_proj.resize(m_ntotal * nquad);
+    m_d_current_cones.resize(num_points_scan());
 
     if (m_debug_print) {
         amrex::Print() << "-------------------------" << std::endl
@@ -217,94 +219,104 @@ bool RadarSampler::update_sampling_locations()
                        << "-------------------------" << std::endl;
     }
 
-    const amrex::Long conetipbegin = m_cone_size - 1 - num_points_quad();
-    const amrex::Long conetipend = m_cone_size;
+    // Assume vertical_ref and radar_ref are normal to each other and unit
+    vs::Vector vertical_ref(m_vertical[0], m_vertical[1], m_vertical[2]);
+    vertical_ref.normalize();
+    const vs::Vector radar_ref(m_axis[0], m_axis[1], m_axis[2]);
+
+    // Sweep and elevation rotations of each cone in this timestep. Cones
+    // that fall outside the time bounds of this timestep are inactive.
+    amrex::Vector<vs::Tensor> h_sweep_rot(m_ntotal, vs::Tensor::identity());
+    amrex::Vector<vs::Tensor> h_elev_rot(m_ntotal, vs::Tensor::identity());
+    amrex::Vector<int> h_active(m_ntotal, 0);
 
     // Loop for oversampling
-    for (int k = 0; k < m_ntotal; k++) {
-        if (k < m_ns) {
-            double per_time = periodic_time();
-            double sweep_angle = determine_current_sweep_angle();
-            double elevation_angle = m_elevation_angles.at(
-                sweep_count() % m_elevation_angles.size());
-
-            if (m_debug_print) {
-                amrex::Print() << "-------------------------" << std::endl
-                               << "Total Sweep: " << total_sweep_time() << "\t"
-                               << "Periodic Time: " << per_time << "\t"
-                               << "Radar Time: " << m_radar_time << "\t"
-                               << "S Angle: " << sweep_angle << "\t"
-                               << "E Angle: " << elevation_angle << "\t"
-                               << "Sim Time: " << time << std::endl
-                               << "-------------------------" << std::endl;
-            }
+    for (int k = 0; k < m_ns && k < m_ntotal; k++) {
+        double per_time = periodic_time();
+        double sweep_angle = determine_current_sweep_angle();
+        double elevation_angle =
+            m_elevation_angles.at(sweep_count() % m_elevation_angles.size());
+
+        if (m_debug_print) {
+            amrex::Print() << "-------------------------" << std::endl
+                           << "Total Sweep: " << total_sweep_time() << "\t"
+                           << "Periodic Time: " << per_time << "\t"
+                           << "Radar Time: " << m_radar_time << "\t"
+                           << "S Angle: " << sweep_angle << "\t"
+                           << "E Angle: " << elevation_angle << "\t"
+                           << "Sim Time: " << time << std::endl
+                           << "-------------------------" << std::endl;
+        }
+
+        h_sweep_rot[k] = vs::quaternion(vertical_ref, sweep_angle);
+        const vs::Vector swept_axis(radar_ref & h_sweep_rot[k]);
+        const vs::Vector elevation_axis(-vertical_ref ^ swept_axis);
+        h_elev_rot[k] = vs::quaternion(elevation_axis, elevation_angle);
+        h_active[k] = 1;
+
+        m_radar_time += dt_sample;
+    }
 
-            vs::Vector vertical_ref(
-                m_vertical[0], m_vertical[1], m_vertical[2]);
-            vs::Vector radar_ref(m_axis[0], m_axis[1], m_axis[2]);
-
-            // Assume vertical_ref and radar_ref are normal to each other and
-            // unit
-            vs::Vector swept_axis(
-                sampling_utils::rotate_euler_vector(
-                    vertical_ref, sweep_angle, radar_ref));
-            vs::Vector elevation_axis(-vertical_ref ^ swept_axis);
-
-            amrex::Long cq_idx = k * num_points_quad();
-
-            // Add rotated cone to current cones
-            for (int i = 0; i < m_cone_size; ++i) {
-                vs::Vector temp_point(
-                    m_initial_cone[i][0] - m_start[0],
-                    m_initial_cone[i][1] - m_start[1],
-                    m_initial_cone[i][2] - m_start[2]);
-                vs::Vector swept_point(
-                    sampling_utils::rotate_euler_vector(
-                        vertical_ref, sweep_angle, temp_point));
-                vs::Vector rotated_point(
-                    sampling_utils::rotate_euler_vector(
-                        elevation_axis, elevation_angle, swept_point));
-                const amrex::Long point_index = i + k * m_cone_size;
-                m_current_cones[point_index][0] = rotated_point[0] + m_start[0];
-                m_current_cones[point_index][1] = rotated_point[1] + m_start[1];
-                m_current_cones[point_index][2] = rotated_point[2] + m_start[2];
-
-                // Add a single cap to help calc line of sight
-                if (i > conetipbegin && i < conetipend) {
-                    vs::Vector unit_cone_point(rotated_point.normalize());
-                    vs::Tensor unit_proj_mat =
-                        sampling_utils::unit_projection_matrix(unit_cone_point);
-                    m_los_unit[cq_idx] = unit_cone_point;
-                    m_los_proj[cq_idx] = unit_proj_mat;
-                    cq_idx++;
+    amrex::Gpu::DeviceVector<vs::Tensor> sweep_rot(m_ntotal);
+    amrex::Gpu::DeviceVector<vs::Tensor> elev_rot(m_ntotal);
+    amrex::Gpu::DeviceVector<int> active(m_ntotal);
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, h_sweep_rot.begin(), h_sweep_rot.end(),
+        sweep_rot.begin());
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, h_elev_rot.begin(), h_elev_rot.end(),
+        elev_rot.begin());
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, h_active.begin(), h_active.end(),
+        active.begin());
+
+    // Rotate the initial cone for all the cones at once, and compute the
+    // line of sight projections on the spherical cap at the tip of the cone
+    const vs::Vector origin(m_start[0], m_start[1], m_start[2]);
+    const amrex::Long cone_size = m_cone_size;
+    const amrex::Long conetipbegin = m_cone_size - nquad;
+    const amrex::Real fill_val = m_fill_val;
+    const auto* init_cone = m_d_initial_cone.data();
+    const auto* sweep_ptr = sweep_rot.data();
+    const auto* elev_ptr = elev_rot.data();
+    const auto* active_ptr = active.data();
+    auto* cones = m_d_current_cones.data();
+    auto* los_unit = m_los_unit.data();
+    auto* los_proj = m_los_proj.data();
+    amrex::ParallelFor(
+        m_ntotal * cone_size, [=] AMREX_GPU_DEVICE(const amrex::Long ip) {
+            const amrex::Long k = ip / cone_size;
+            const amrex::Long i = ip - k * cone_size;
+            vs::Vector rotated_point = vs::Vector::zero();
+            if (active_ptr[k] != 0) {
+                const vs::Vector temp_point(
+                    init_cone[i][0] - origin[0], init_cone[i][1] - origin[1],
+                    init_cone[i][2] - origin[2]);
+                rotated_point = (temp_point & sweep_ptr[k]) & elev_ptr[k];
+                for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+                    cones[ip][d] = rotated_point[d] + origin[d];
+                }
+            } else {
+                for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+                    cones[ip][d] = fill_val;
                 }
             }
 
-            m_radar_time += dt_sample;
-
-        } else {
-            // This cone falls outside time bounds
-            // For this timestep
-            amrex::Long cq_idx = k * num_points_quad();
-
-            for (int i = 0; i < m_cone_size; ++i) {
-                const amrex::Long point_index = i + k * m_cone_size;
-                m_current_cones[point_index][0] = m_fill_val;
-                m_current_cones[point_index][1] = m_fill_val;
-                m_current_cones[point_index][2] = m_fill_val;
-
-                // Create zero projection matrix
-                if (i > conetipbegin && i < conetipend) {
-                    vs::Vector unit_zero_point(0.0, 0.0, 0.0);
-                    vs::Tensor zero_mat =
-                        sampling_utils::unit_projection_matrix(unit_zero_point);
-                    m_los_unit[cq_idx] = unit_zero_point;
-                    m_los_proj[cq_idx] = zero_mat;
-                    cq_idx++;
-                }
+            // Add a single cap to help calc line of sight
+            if (i >= conetipbegin) {
+                const amrex::Long cq_idx = k * nquad + i - conetipbegin;
+                const vs::Vector unit_cone_point =
+                    (active_ptr[k] != 0) ? rotated_point.unit()
+                                         : vs::Vector::zero();
+                los_unit[cq_idx] = unit_cone_point;
+                los_proj[cq_idx] =
+                    sampling_utils::unit_projection_matrix(unit_cone_point);
             }
-        }
-    }
+        });
+
+    amrex::Gpu::copy(
+        amrex::Gpu::deviceToHost, m_d_current_cones.begin(),
+        m_d_current_cones.end(), m_current_cones.begin());
 
     m_radar_iter++;
 
@@ -373,43 +385,64 @@ void RadarSampler::new_cone()
         m_initial_cone[i][1] = new_rot[1] * m_beam_length + m_start[1];
         m_initial_cone[i][2] = new_rot[2] * m_beam_length + m_start[2];
     }
+
+    m_d_initial_cone.resize(m_initial_cone.size());
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, m_initial_cone.begin(), m_initial_cone.end(),
+        m_d_initial_cone.begin());
+    m_d_weights.resize(m_weights.size());
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, m_weights.begin(), m_weights.end(),
+        m_d_weights.begin());
 }
 
 void RadarSampler::calc_lineofsight_velocity(
-    const std::vector<std::vector<double>>& velocity_raw, const int interp_idx)
+    const std::array<const double*, AMREX_SPACEDIM>& velocity_raw,
+    const int interp_idx)
 {
-    AMREX_ALWAYS_ASSERT(
-        static_cast<int>(velocity_raw.size()) == num_points_scan());
+    const amrex::Long nscan = num_points_scan();
 
     m_los_velocity_next.resize(num_output_points());
     m_los_velocity.resize(num_output_points());
     m_los_velocity_prior.resize(num_output_points());
 
-    std::vector<double> los_temp(num_points_scan());
-
-    for (int k = 0; k < m_ntotal; k++) {
-        for (int i = 0; i < m_cone_size; ++i) {
-            const amrex::Long p_idx = i + k * m_cone_size;
-            const amrex::Long cq_idx = i % num_points_quad();
-            vs::Vector temp_vel(
-                velocity_raw[p_idx][0], velocity_raw[p_idx][1],
-                velocity_raw[p_idx][2]);
-            vs::Vector los_vel_vector(temp_vel & m_los_proj[cq_idx]);
-            los_temp[p_idx] = (los_vel_vector & m_los_unit[cq_idx]);
-        }
+    amrex::Gpu::DeviceVector<double> vel(AMREX_SPACEDIM * nscan);
+    for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+        amrex::Gpu::copyAsync(
+            amrex::Gpu::hostToDevice, velocity_raw[d], velocity_raw[d] + nscan,
+            vel.begin() + d * nscan);
     }
 
-    for (int k = 0; k < m_ntotal; k++) {
-        const amrex::Long a_start = k * num_points_axis();
-        std::vector<double> temp_vals(
-            los_temp.begin() + k * num_points_cone(),
-            los_temp.begin() + (k + 1) * num_points_cone());
-        if (interp_idx > 0) {
-            line_average(m_weights, temp_vals, m_los_velocity_next, a_start);
-        } else {
-            line_average(m_weights, temp_vals, m_los_velocity, a_start);
-        }
-    }
+    // Project the velocity onto the line of sight and average over the
+    // quadrature points of each line in a single pass
+    const auto nquad = static_cast<int>(num_points_quad());
+    amrex::Gpu::DeviceVector<double> los_avg(num_output_points());
+    const auto* vel_ptr = vel.data();
+    const auto* weights = m_d_weights.data();
+    const auto* los_unit = m_los_unit.data();
+    const auto* los_proj = m_los_proj.data();
+    auto* avg = los_avg.data();
+    amrex::ParallelFor(
+        num_output_points(), [=] AMREX_GPU_DEVICE(const amrex::Long n) {
+            double weight_sum = 0;
+            double average = 0;
+            for (int j = 0; j < nquad; ++j) {
+                const amrex::Long p_idx = n * nquad + j;
+                const vs::Vector temp_vel(
+                    vel_ptr[p_idx], vel_ptr[nscan + p_idx],
+                    vel_ptr[2 * nscan + p_idx]);
+                const vs::Vector los_vel_vector(temp_vel & los_proj[j]);
+                weight_sum += weights[j];
+                average += weights[j] * (los_vel_vector & los_unit[j]);
+            }
+            avg[n] = (weight_sum > 0) ? average / weight_sum : 0.0;
+        });
+
+    auto& los_velocity =
+        (interp_idx > 0) ? m_los_velocity_next : m_los_velocity;
+    amrex::Gpu::copy(
+        amrex::Gpu::deviceToHost, los_avg.begin(), los_avg.end(),
+        los_velocity.begin());
 }
 
 // TODO: Fix modify_sample_data...single var output, not multiple
@@ -420,45 +453,44 @@ std::vector<double> RadarSampler::modify_sample_data(
     // there are m_ntotal steps (cones) based on sampling rate
     AMREX_ALWAYS_ASSERT(static_cast<int>(sample_data.size()) == num_points());
 
-    const amrex::Long n_cones = m_ntotal;
-    std::vector<double> mod_data(num_output_points());
-
-    for (int ic = 0; ic < n_cones; ++ic) {
-        const amrex::Long c_start = ic * num_points_cone();
-        const amrex::Long c_end = (ic + 1) * num_points_cone();
-        const amrex::Long a_start = ic * num_points_axis();
+    // Line average all the cones at once
+    amrex::Gpu::DeviceVector<double> values(num_points_scan());
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, sample_data.begin(),
+        sample_data.begin() + num_points_scan(), values.begin());
+    amrex::Gpu::DeviceVector<double> reduced;
+    line_average(m_d_weights, values, reduced);
 
-        // Send a single cone to be line averaged
-        std::vector<double> temp_vals(
-            sample_data.begin() + c_start, sample_data.begin() + c_end);
-        line_average(m_weights, temp_vals, mod_data, a_start);
-    }
+    std::vector<double> mod_data(num_output_points());
+    amrex::Gpu::copy(
+        amrex::Gpu::deviceToHost, reduced.begin(), reduced.end(),
+        mod_data.begin());
 
     return mod_data;
 }
 
 void RadarSampler::line_average(
-    const std::vector<double>& weights,
-    const std::vector<double>& values,
-    std::vector<double>& reduced,
-    const amrex::Long offset)
+    const amrex::Gpu::DeviceVector<double>& weights,
+    const amrex::Gpu::DeviceVector<double>& values,
+    amrex::Gpu::DeviceVector<double>& reduced)
 {
-    const int nline = static_cast<int>(values.size() / weights.size());
-    const int nquad = static_cast<int>(weights.size());
-    for (int n = 0; n < nline; ++n) {
+    const auto nquad = static_cast<int>(weights.size());
+    const auto nline = static_cast<amrex::Long>(values.size() / nquad);
+    reduced.resize(nline);
+
+    const auto* wts = weights.data();
+    const auto* vals = values.data();
+    auto* red = reduced.data();
+    amrex::ParallelFor(nline, [=] AMREX_GPU_DEVICE(const amrex::Long n) {
         double weight_sum = 0;
         double average = 0;
         for (int j = 0; j < nquad; ++j) {
-            const int point_idx = nquad * n + j;
-            weight_sum += weights[j];
-            average += weights[j] * values[point_idx];
-        }
-        if (weight_sum > 0) {
-            reduced[n + offset] = average / weight_sum;
-        } else {
-            reduced[n + offset] = 0;
+            const amrex::Long point_idx = nquad * n + j;
+            weight_sum += wts[j];
+            average += wts[j] * vals[point_idx];
         }
-    }
+        red[n] = (weight_sum > 0) ? average / weight_sum : 0.0;
+    });
 }
 
 void RadarSampler::sampling_locations(SampleLocType& sample_locs) const
@@ -1,4 +1,6 @@
+#include <algorithm>
 #include <memory>
+#include <tuple>
 #include <utility>
 
 #include "amr-wind/utilities/sampling/Sampling.H"
@@ -48,6 +50,13 @@ void Sampling::initialize()
         pp.queryarr("derived_fields", derived_field_names);
         pp.query("output_format", m_out_fmt);
         pp.query("restart_sample", m_restart_sample);
+        pp.query("incremental_relocation", m_incremental_relocation);
+        pp.query("output_buffer_size", m_out_buffer_size);
+        AMREX_ALWAYS_ASSERT(m_out_buffer_size > 0);
+#ifdef AMR_WIND_USE_NETCDF
+        pp.query("netcdf_parallel_output", m_netcdf_parallel);
+        ioutils::query_netcdf_options(pp, "", m_nc_opts);
+#endif
         populate_output_parameters(pp);
     }
 
@@ -121,10 +130,48 @@ void Sampling::initialize()
 
     update_container();
 
+    if ((m_out_buffer_size > 1) && (m_out_fmt != "netcdf")) {
+        amrex::Print() << "WARNING: Sampling: output_buffer_size requires "
+                          "netcdf output, writing every output step"
+                       << std::endl;
+        m_out_buffer_size = 1;
+    }
+    if (m_out_buffer_size > 1) {
+        for (const auto& obj : m_samplers) {
+            if (obj->do_data_modification() || obj->do_convert_velocity_los() ||
+                obj->do_output_netcdf_data() ||
+                (obj->num_output_points() != obj->num_points())) {
+                amrex::Print() << "WARNING: Sampling: " << obj->label()
+                               << " does not support buffered output, writing "
+                                  "every output step"
+                               << std::endl;
+                m_out_buffer_size = 1;
+                break;
+            }
+        }
+    }
+
 #ifdef AMR_WIND_USE_NETCDF
+    if (m_netcdf_parallel) {
+        for (const auto& obj : m_samplers) {
+            if (obj->do_data_modification() ||
+                obj->do_convert_velocity_los() ||
+                (obj->num_output_points() != obj->num_points())) {
+                amrex::Print() << "WARNING: Sampling: " << obj->label()
+                               << " does not support parallel netcdf output, "
+                                  "reverting to serial output"
+                               << std::endl;
+                m_netcdf_parallel = false;
+                break;
+            }
+        }
+    }
+
     if (m_out_fmt == "netcdf") {
         prepare_netcdf_file();
-        m_sample_buf.assign(m_total_particles * m_var_names.size(), 0.0);
+        if (!m_netcdf_parallel) {
+            m_sample_buf.assign(m_total_particles * m_var_names.size(), 0.0);
+        }
     }
 #endif
 
@@ -163,15 +210,21 @@ void Sampling::update_sampling_locations()
 {
     BL_PROFILE("amr-wind::Sampling::update_sampling_locations");
 
-    amrex::Vector<bool> updated_position;
-    for (const auto& obj : m_samplers) {
-        const bool updated_pos = obj->update_sampling_locations();
-        updated_position.push_back(updated_pos);
+    amrex::Vector<int> moved;
+    for (int i = 0; i < static_cast<int>(m_samplers.size()); ++i) {
+        if (m_samplers[i]->update_sampling_locations()) {
+            moved.push_back(i);
+        }
+    }
+
+    if (moved.empty()) {
+        return;
     }
 
-    if (std::any_of(
-            updated_position.begin(), updated_position.end(),
-            [](const auto& v) { return v; })) {
+    // Relocate the particles of the moving samplers in place, falling back to
+    // re-initializing the container if some sampling locations are missing
+    if (!m_incremental_relocation ||
+        !m_scontainer->update_particle_locations(m_samplers, moved)) {
         update_container();
     }
 }
@@ -224,6 +277,24 @@ void Sampling::sampling_post()
 #endif
 }
 
+void Sampling::post_advance_work()
+{
+    // Buffered output steps are written out before checkpoints so that the
+    // output file is consistent with the restart state
+    if (m_sim.time().write_checkpoint()) {
+        flush_outputs();
+    }
+}
+
+void Sampling::flush_outputs()
+{
+#ifdef AMR_WIND_USE_NETCDF
+    if (!m_pending_times.empty()) {
+        flush_netcdf_output();
+    }
+#endif
+}
+
 void Sampling::post_regrid_actions()
 {
     BL_PROFILE("amr-wind::Sampling::post_regrid_actions");
@@ -233,13 +304,14 @@ void Sampling::post_regrid_actions()
     }
 
     m_scontainer->Redistribute();
+    m_scontainer->clear_stencils();
 }
 
 void Sampling::convert_velocity_lineofsight()
 {
     BL_PROFILE("amr-wind::Sampling::convert_velocity_lineofsight");
 
-    if (m_out_fmt != "netcdf") {
+    if ((m_out_fmt != "netcdf") || m_netcdf_parallel) {
         return;
     }
 
@@ -256,36 +328,27 @@ void Sampling::convert_velocity_lineofsight()
         }
     }
 
+    // The samplers read the velocity directly from the sample buffer
+    const long ntotal = m_scontainer->num_sampling_particles();
     long soffset = 0;
     for (const auto& obj : m_samplers) {
-        long sample_size =
-            obj->num_points(); // sample locs for individual sampler
-
-        long scan_size =
-            (obj->do_subsampling_interp()) ? sample_size / 2 : sample_size;
-
-        std::vector<std::vector<double>> temp_vel(
-            scan_size, std::vector<double>(AMREX_SPACEDIM));
-        std::vector<std::vector<double>> temp_vel_next(
-            scan_size, std::vector<double>(AMREX_SPACEDIM));
+        // sample locs for individual sampler
+        const long sample_size = obj->num_points();
 
         if (obj->do_convert_velocity_los()) {
+            const long scan_size = (obj->do_subsampling_interp())
+                                       ? sample_size / 2
+                                       : sample_size;
+            std::array<const double*, AMREX_SPACEDIM> vel;
             for (int iv = 0; iv < AMREX_SPACEDIM; ++iv) {
-                long vel_off = vel_map[iv];
-
-                long offset =
-                    vel_off * m_scontainer->num_sampling_particles() + soffset;
-                for (int j = 0; j < scan_size; ++j) {
-                    temp_vel[j][iv] = m_sample_buf[offset + j];
-                    if (obj->do_subsampling_interp()) {
-                        temp_vel_next[j][iv] =
-                            m_sample_buf[scan_size + offset + j];
-                    }
-                }
+                vel[iv] = &m_sample_buf[vel_map[iv] * ntotal + soffset];
             }
-            obj->calc_lineofsight_velocity(temp_vel, 0);
+            obj->calc_lineofsight_velocity(vel, 0);
             if (obj->do_subsampling_interp()) {
-                obj->calc_lineofsight_velocity(temp_vel_next, 1);
+                for (int iv = 0; iv < AMREX_SPACEDIM; ++iv) {
+                    vel[iv] += scan_size;
+                }
+                obj->calc_lineofsight_velocity(vel, 1);
             }
         }
         soffset += sample_size;
@@ -301,7 +364,8 @@ void Sampling::create_output_buffer()
 {
     BL_PROFILE("amr-wind::Sampling::create_output_buffer");
 
-    if (m_out_fmt != "netcdf") {
+    if ((m_out_fmt != "netcdf") || m_netcdf_parallel ||
+        (m_out_buffer_size > 1)) {
         return;
     }
 
@@ -342,9 +406,15 @@ void Sampling::create_output_buffer()
 void Sampling::fill_buffer()
 {
     BL_PROFILE("amr-wind::Sampling::fill_buffer");
-    if (m_out_fmt == "netcdf") {
+    // Buffered outputs pack the local records when the output step is written
+    if ((m_out_fmt == "netcdf") && (m_out_buffer_size == 1)) {
 #ifdef AMR_WIND_USE_NETCDF
-        m_scontainer->populate_buffer(m_sample_buf);
+        if (m_netcdf_parallel) {
+            std::tie(m_block_start, m_block_count) =
+                m_scontainer->populate_block_buffer(m_sample_buf);
+        } else {
+            m_scontainer->populate_buffer(m_sample_buf);
+        }
 #else
         amrex::Abort(
             "NetCDF support was not enabled during build time. Please "
@@ -486,12 +556,44 @@ void Sampling::prepare_netcdf_file()
 
     m_ncfile_name = post_dir + "/" + sname + ".nc";
 
+    if (m_netcdf_parallel) {
+        prepare_netcdf_file_par();
+        return;
+    }
+
     // Only I/O processor handles NetCDF generation
     if (!amrex::ParallelDescriptor::IOProcessor()) {
         return;
     }
 
     auto ncf = ncutils::NCFile::create(m_ncfile_name, NC_CLOBBER | NC_NETCDF4);
+    define_netcdf_file(ncf);
+
+    {
+        const std::vector<size_t> start{0, 0};
+        std::vector<size_t> count{0, AMREX_SPACEDIM};
+        for (const auto& obj : m_samplers) {
+            auto grp = ncf.group(obj->label());
+            obj->populate_netcdf_metadata(grp);
+            SampleLocType sample_locs;
+            obj->output_locations(sample_locs);
+            auto xyz = grp.var("coordinates");
+            count[0] = obj->num_output_points();
+            const auto& locs = sample_locs.locations();
+            xyz.put(locs[0].begin(), start, count);
+        }
+    }
+
+#else
+    amrex::Abort(
+        "NetCDF support was not enabled during build time. Please recompile or "
+        "use native format");
+#endif
+}
+
+#ifdef AMR_WIND_USE_NETCDF
+void Sampling::define_netcdf_file(ncutils::NCFile& ncf)
+{
     const std::string nt_name = "num_time_steps";
     const std::string npart_name = "num_points";
     const std::vector<std::string> two_dim{nt_name, npart_name};
@@ -514,45 +616,200 @@ void Sampling::prepare_netcdf_file()
         // Removing velocity components when LOS velocity is output
         for (const std::string& vname : m_var_names) {
             if (!obj->do_convert_velocity_los()) {
-                grp.def_var(vname, NC_DOUBLE, two_dim);
+                grp.def_var(vname, NC_DOUBLE, two_dim, m_nc_opts);
             } else {
                 if (vname.find("velocity") == std::string::npos) {
-                    grp.def_var(vname, NC_DOUBLE, two_dim);
+                    grp.def_var(vname, NC_DOUBLE, two_dim, m_nc_opts);
                 }
             }
         }
 
         if (obj->do_convert_velocity_los()) {
-            grp.def_var("los_velocity", NC_DOUBLE, two_dim);
+            grp.def_var("los_velocity", NC_DOUBLE, two_dim, m_nc_opts);
         }
     }
     ncf.exit_def_mode();
+}
 
-    {
-        const std::vector<size_t> start{0, 0};
-        std::vector<size_t> count{0, AMREX_SPACEDIM};
+void Sampling::prepare_netcdf_file_par()
+{
+    // All processors create the file and write the coordinates of the
+    // sampling locations in their block of particle UIDs
+    auto ncf = ncutils::NCFile::create_par(
+        m_ncfile_name, NC_CLOBBER | NC_NETCDF4 | NC_MPIIO,
+        amrex::ParallelContext::CommunicatorSub(), MPI_INFO_NULL);
+    define_netcdf_file(ncf);
+    set_collective_access(ncf);
+
+    const long ntotal = m_scontainer->num_sampling_particles();
+    const int nprocs = amrex::ParallelDescriptor::NProcs();
+    const int iproc = amrex::ParallelDescriptor::MyProc();
+    const long blo = SamplingContainer::uid_block_start(iproc, ntotal, nprocs);
+    const long bhi =
+        SamplingContainer::uid_block_start(iproc + 1, ntotal, nprocs);
+
+    long uid_offset = 0;
+    for (const auto& obj : m_samplers) {
+        auto grp = ncf.group(obj->label());
+        obj->populate_netcdf_metadata(grp);
+        SampleLocType sample_locs;
+        obj->output_locations(sample_locs);
+        const auto& locs = sample_locs.locations();
+
+        const long lo = std::clamp(blo - uid_offset, 0L, obj->num_points());
+        const long hi = std::clamp(bhi - uid_offset, 0L, obj->num_points());
+        const std::vector<size_t> start{static_cast<size_t>(lo), 0};
+        const std::vector<size_t> count{
+            static_cast<size_t>(hi - lo), AMREX_SPACEDIM};
+        const double* ptr = (hi > lo) ? locs[lo].begin() : nullptr;
+        grp.var("coordinates").put(ptr, start, count);
+        uid_offset += obj->num_points();
+    }
+}
+
+void Sampling::set_collective_access(const ncutils::NCGroup& grp)
+{
+    for (const auto& var : grp.all_vars()) {
+        var.par_access(NC_COLLECTIVE);
+    }
+    for (const auto& sub : grp.all_groups()) {
+        set_collective_access(sub);
+    }
+}
+
+void Sampling::write_netcdf_par(const std::vector<double>& times)
+{
+    // Every processor writes the sampled data of its block of particle UIDs
+    // for all the output steps with a single collective put per variable and
+    // sampler
+    auto ncf = ncutils::NCFile::open_par(
+        m_ncfile_name, NC_WRITE | NC_NETCDF4 | NC_MPIIO,
+        amrex::ParallelContext::CommunicatorSub(), MPI_INFO_NULL);
+    set_collective_access(ncf);
+
+    const std::string nt_name = "num_time_steps";
+    const size_t nt = ncf.dim(nt_name).len();
+    const size_t nsteps = times.size();
+    ncf.var("time").put(times.data(), {nt}, {nsteps});
+
+    for (const auto& obj : m_samplers) {
+        auto grp = ncf.group(obj->label());
+        obj->output_netcdf_data(grp, nt);
+    }
+
+    const long blo = m_block_start;
+    const long bhi = m_block_start + m_block_count;
+    const auto nvars = m_var_names.size();
+    std::vector<double> recs;
+    for (int iv = 0; iv < nvars; ++iv) {
+        long uid_offset = 0;
         for (const auto& obj : m_samplers) {
             auto grp = ncf.group(obj->label());
-            obj->populate_netcdf_metadata(grp);
-            SampleLocType sample_locs;
-            obj->output_locations(sample_locs);
-            auto xyz = grp.var("coordinates");
-            count[0] = obj->num_output_points();
-            const auto& locs = sample_locs.locations();
-            xyz.put(locs[0].begin(), start, count);
+            const long lo = std::clamp(blo - uid_offset, 0L, obj->num_points());
+            const long hi = std::clamp(bhi - uid_offset, 0L, obj->num_points());
+            const long npts = hi - lo;
+            const long boffset = uid_offset + lo - blo;
+            recs.resize(nsteps * npts);
+            for (size_t is = 0; (is < nsteps) && (npts > 0); ++is) {
+                const double* src =
+                    &m_sample_buf[(is * nvars + iv) * m_block_count + boffset];
+                std::copy(src, src + npts, &recs[is * npts]);
+            }
+            const std::vector<size_t> start{nt, static_cast<size_t>(lo)};
+            const std::vector<size_t> count{
+                nsteps, static_cast<size_t>(npts)};
+            grp.var(m_var_names[iv])
+                .put((npts > 0) ? recs.data() : nullptr, start, count);
+            uid_offset += obj->num_points();
         }
     }
 
-#else
-    amrex::Abort(
-        "NetCDF support was not enabled during build time. Please recompile or "
-        "use native format");
-#endif
+    ncf.close();
 }
 
+void Sampling::write_netcdf_records(const std::vector<double>& times)
+{
+    if (!amrex::ParallelDescriptor::IOProcessor()) {
+        return;
+    }
+
+    auto ncf = ncutils::NCFile::open(m_ncfile_name, NC_WRITE);
+    const std::string nt_name = "num_time_steps";
+    // Index of the first output step
+    const size_t nt = ncf.dim(nt_name).len();
+    const size_t nsteps = times.size();
+    ncf.var("time").put(times.data(), {nt}, {nsteps});
+
+    // The output steps of every variable and sampler are appended with a
+    // single put
+    const long ntotal = m_scontainer->num_sampling_particles();
+    const auto nvars = m_var_names.size();
+    std::vector<double> recs;
+    for (int iv = 0; iv < nvars; ++iv) {
+        long soffset = 0;
+        for (const auto& obj : m_samplers) {
+            const long npts = obj->num_points();
+            recs.resize(nsteps * npts);
+            for (size_t is = 0; is < nsteps; ++is) {
+                const double* src =
+                    &m_sample_buf[(is * nvars + iv) * ntotal + soffset];
+                std::copy(src, src + npts, &recs[is * npts]);
+            }
+            auto grp = ncf.group(obj->label());
+            grp.var(m_var_names[iv])
+                .put(recs.data(), {nt, 0}, {nsteps, static_cast<size_t>(npts)});
+            soffset += npts;
+        }
+    }
+
+    ncf.close();
+}
+
+void Sampling::buffer_netcdf_output()
+{
+    BL_PROFILE("amr-wind::Sampling::buffer_netcdf_output");
+
+    m_pending_nlocal.push_back(m_scontainer->pack_records(m_pending_records));
+    m_pending_times.push_back(m_sim.time().new_time());
+
+    if ((static_cast<int>(m_pending_times.size()) >= m_out_buffer_size) ||
+        m_sim.time().write_checkpoint()) {
+        flush_netcdf_output();
+    }
+}
+
+void Sampling::flush_netcdf_output()
+{
+    BL_PROFILE("amr-wind::Sampling::flush_netcdf_output");
+
+    if (m_netcdf_parallel) {
+        std::tie(m_block_start, m_block_count) =
+            m_scontainer->populate_block_buffer(
+                m_pending_records, m_pending_nlocal, m_sample_buf);
+        write_netcdf_par(m_pending_times);
+    } else {
+        m_scontainer->populate_buffer(
+            m_pending_records, m_pending_nlocal, m_sample_buf);
+        write_netcdf_records(m_pending_times);
+    }
+
+    m_pending_records.clear();
+    m_pending_nlocal.clear();
+    m_pending_times.clear();
+}
+#endif
+
 void Sampling::write_netcdf()
 {
 #ifdef AMR_WIND_USE_NETCDF
+    if (m_out_buffer_size > 1) {
+        buffer_netcdf_output();
+        return;
+    }
+    if (m_netcdf_parallel) {
+        write_netcdf_par({m_sim.time().new_time()});
+        return;
+    }
     if (!amrex::ParallelDescriptor::IOProcessor()) {
         return;
     }
@@ -2,9 +2,26 @@
 #include "amr-wind/utilities/sampling/SamplingContainer.H"
 #include "amr-wind/utilities/sampling/SamplerBase.H"
 #include "amr-wind/core/Field.H"
+#include "amr-wind/utilities/index_operations.H"
+
+#include <limits>
+#include <numeric>
 
 namespace amr_wind::sampling {
 
+namespace {
+
+//! Sampling location and particle identifiers binned into a tile
+struct SampleParticleInfo
+{
+    amrex::RealVect loc;
+    int uid;
+    int sid;
+    int nid;
+};
+
+} // namespace
+
 void SamplingContainer::setup_container(
     const int num_real_components, const int num_int_components)
 {
@@ -35,37 +52,64 @@ void SamplingContainer::initialize_particles(
 
     const int lev = 0;
     const auto iproc = amrex::ParallelDescriptor::MyProc();
+    const auto& ba = ParticleBoxArray(lev);
+    const auto& dm = ParticleDistributionMap(lev);
+    const auto& dxinv = m_mesh.Geom(lev).InvCellSizeArray();
+    const auto& plo = m_mesh.Geom(lev).ProbLoArray();
 
+    m_stencils.clear();
     m_total_particles = 0;
     for (const auto& probes : samplers) {
         m_total_particles += probes->num_points();
     }
 
-    const int nprobes = static_cast<int>(samplers.size());
-#ifdef AMREX_DEBUG
-    const auto& dxinv = m_mesh.Geom(lev).InvCellSizeArray();
-    const auto& plo = m_mesh.Geom(lev).ProbLoArray();
-#endif
+    // Bin all sampling locations into the locally owned grids in a single
+    // pass, using the box array hash to find the grid containing each point
+    amrex::Vector<amrex::Vector<SampleParticleInfo>> buckets(ba.size());
+    std::vector<std::pair<int, amrex::Box>> isects;
+    int uid_offset = 0;
+    for (const auto& probe : samplers) {
+        SampleLocType sample_locs;
+        probe->sampling_locations(sample_locs);
+        const auto& locs = sample_locs.locations();
+        const auto& ids = sample_locs.ids();
+        const auto probe_id = probe->id();
+        for (int ip = 0; ip < static_cast<int>(locs.size()); ++ip) {
+            const auto& loc = locs[ip];
+            const amrex::IntVect iv(AMREX_D_DECL(
+                static_cast<int>(
+                    amrex::Math::floor((loc[0] - plo[0]) * dxinv[0])),
+                static_cast<int>(
+                    amrex::Math::floor((loc[1] - plo[1]) * dxinv[1])),
+                static_cast<int>(
+                    amrex::Math::floor((loc[2] - plo[2]) * dxinv[2]))));
+            ba.intersections(amrex::Box(iv, iv), isects, true, 0);
+            if (isects.empty() || dm[isects[0].first] != iproc) {
+                continue;
+            }
+            const int nid = static_cast<int>(ids[ip]);
+            buckets[isects[0].first].push_back(
+                {loc, nid + uid_offset, probe_id, nid});
+        }
+        uid_offset += probe->num_points();
+    }
 
 #ifdef AMREX_USE_OMP
 #pragma omp parallel if (false)
 #endif
     for (amrex::MFIter mfi = MakeMFIter(lev); mfi.isValid(); ++mfi) {
         const amrex::Box& box = mfi.tilebox();
+        const auto& bucket = buckets[mfi.index()];
 
-        int np_box = 0;
-        amrex::Vector<SampleLocType> vec_sample_locs(nprobes);
-        for (int iprobe = 0; iprobe < nprobes; iprobe++) {
-            const auto& probe = samplers[iprobe];
-
-            SampleLocType sample_locs;
-            probe->sampling_locations(sample_locs, {box});
-            const auto& locs = sample_locs.locations();
-            const int npts = static_cast<int>(locs.size());
-            np_box += static_cast<int>(npts);
-            vec_sample_locs[iprobe] = sample_locs;
+        amrex::Vector<SampleParticleInfo> tile_info;
+        tile_info.reserve(bucket.size());
+        for (const auto& info : bucket) {
+            if (utils::contains(box, info.loc, plo, dxinv)) {
+                tile_info.push_back(info);
+            }
         }
 
+        const int np_box = static_cast<int>(tile_info.size());
         const int grid_id = mfi.index();
         const int tile_id = mfi.LocalTileIndex();
         auto& ptile = GetParticles(lev)[std::make_pair(grid_id, tile_id)];
@@ -75,70 +119,137 @@ void SamplingContainer::initialize_particles(
             continue;
         }
 
-        int offset = 0;
-        for (int iprobe = 0; iprobe < nprobes; iprobe++) {
-            const auto& probe = samplers[iprobe];
-            auto sample_locs = vec_sample_locs[iprobe];
-            const auto& locs = sample_locs.locations();
-            const int npts = static_cast<int>(locs.size());
-            if (npts == 0) {
-                continue;
-            }
+        amrex::Gpu::DeviceVector<SampleParticleInfo> dinfo(np_box);
+        amrex::Gpu::copy(
+            amrex::Gpu::hostToDevice, tile_info.begin(), tile_info.end(),
+            dinfo.begin());
+        const auto* p_dinfo = dinfo.data();
 
-            const int uid_offset = std::accumulate(
-                samplers.begin(), samplers.begin() + iprobe, 0,
-                [&](int sum, const auto& s) { return sum + s->num_points(); });
-            const auto probe_id = probe->id();
-            amrex::Gpu::DeviceVector<amrex::RealVect> dlocs(npts);
-            amrex::Gpu::copy(
-                amrex::Gpu::hostToDevice, locs.begin(), locs.end(),
-                dlocs.begin());
-            const auto* p_dlocs = dlocs.data();
-            const auto& ids = sample_locs.ids();
-            amrex::Gpu::DeviceVector<amrex::Long> dids(npts);
-            amrex::Gpu::copy(
-                amrex::Gpu::hostToDevice, ids.begin(), ids.end(), dids.begin());
-            const auto* p_dids = dids.data();
+        const amrex::Long nextid = ParticleType::NextID();
+        ParticleType::NextID(nextid + np_box);
+
+        auto* pstruct = ptile.GetArrayOfStructs()().data();
+        amrex::ParallelFor(
+            np_box, [=] AMREX_GPU_DEVICE(const int ip) noexcept {
+                const auto& info = p_dinfo[ip];
+                auto& pp = pstruct[ip];
+                pp.id() = nextid + ip;
+                pp.cpu() = iproc;
+                for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+                    pp.pos(idim) = info.loc[idim];
+                }
+                pp.idata(IIx::uid) = info.uid;
+                pp.idata(IIx::sid) = info.sid;
+                pp.idata(IIx::nid) = info.nid;
+            });
+        amrex::Gpu::streamSynchronize();
+    }
+    // Skip this check if there is a DTUSpinnerSampler (may have out of domain
+    // particles)
+    if (std::all_of(samplers.cbegin(), samplers.cend(), [](const auto& probe) {
+            return probe->sampletype() != "DTUSpinnerSampler";
+        })) {
+        AMREX_ALWAYS_ASSERT(m_total_particles == TotalNumberOfParticles(false));
+    }
+}
+
+bool SamplingContainer::update_particle_locations(
+    const amrex::Vector<std::unique_ptr<SamplerBase>>& samplers,
+    const amrex::Vector<int>& moved)
+{
+    BL_PROFILE("amr-wind::SamplingContainer::update_particle_locations");
+
+    // Points that are not in the container (e.g., outside the domain) can
+    // only be recovered by re-initializing the particles
+    if (TotalNumberOfParticles() != m_total_particles) {
+        return false;
+    }
+
+    // Gather the new locations of the moving samplers indexed by node id
+    amrex::Vector<int> loc_offset(samplers.size(), -1);
+    amrex::Vector<amrex::RealVect> locs;
+    for (const int iprobe : moved) {
+        const auto& probe = samplers[iprobe];
+        SampleLocType sample_locs;
+        probe->sampling_locations(sample_locs);
+        const auto& plocs = sample_locs.locations();
+        const auto& ids = sample_locs.ids();
+        if (static_cast<long>(plocs.size()) != probe->num_points()) {
+            return false;
+        }
+
+        const auto offset = static_cast<int>(locs.size());
+        loc_offset[probe->id()] = offset;
+        locs.resize(offset + plocs.size());
+        for (int ip = 0; ip < static_cast<int>(plocs.size()); ++ip) {
+            locs[offset + ids[ip]] = plocs[ip];
+        }
+    }
 
-            const amrex::Long nextid = ParticleType::NextID();
-            ParticleType::NextID(nextid + npts);
+    amrex::Gpu::DeviceVector<int> dloc_offset(loc_offset.size());
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, loc_offset.begin(), loc_offset.end(),
+        dloc_offset.begin());
+    amrex::Gpu::DeviceVector<amrex::RealVect> dlocs(locs.size());
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, locs.begin(), locs.end(), dlocs.begin());
+    const auto* p_offset = dloc_offset.data();
+    const auto* p_dlocs = dlocs.data();
 
-            auto* pstruct = ptile.GetArrayOfStructs()().data();
+    const int nlevels = m_mesh.finestLevel() + 1;
+    for (int lev = 0; lev < nlevels; ++lev) {
+        for (ParIterType pti(*this, lev); pti.isValid(); ++pti) {
+            const int np = pti.numParticles();
+            auto* pstruct = pti.GetArrayOfStructs()().data();
             amrex::ParallelFor(
-                npts, [=] AMREX_GPU_DEVICE(const int ip) noexcept {
-                    const amrex::RealVect loc(AMREX_D_DECL(
-                        p_dlocs[ip][0], p_dlocs[ip][1], p_dlocs[ip][2]));
-#ifdef AMREX_DEBUG
-                    const amrex::IntVect div(AMREX_D_DECL(
-                        static_cast<int>(
-                            amrex::Math::floor((loc[0] - plo[0]) * dxinv[0])),
-                        static_cast<int>(
-                            amrex::Math::floor((loc[1] - plo[1]) * dxinv[1])),
-                        static_cast<int>(
-                            amrex::Math::floor((loc[2] - plo[2]) * dxinv[2]))));
-                    AMREX_ASSERT(box.contains(div));
-#endif
-                    auto& pp = pstruct[offset + ip];
-                    pp.id() = nextid + ip;
-                    pp.cpu() = iproc;
+                np, [=] AMREX_GPU_DEVICE(const int ip) noexcept {
+                    auto& pp = pstruct[ip];
+                    const int offset = p_offset[pp.idata(IIx::sid)];
+                    if (offset < 0) {
+                        return;
+                    }
+                    const auto& loc = p_dlocs[offset + pp.idata(IIx::nid)];
                     for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
                         pp.pos(idim) = loc[idim];
                     }
-                    pp.idata(IIx::uid) =
-                        static_cast<int>(p_dids[ip] + uid_offset);
-                    pp.idata(IIx::sid) = probe_id;
-                    pp.idata(IIx::nid) = static_cast<int>(p_dids[ip]);
                 });
-            offset += npts;
         }
     }
-    // Skip this check if there is a DTUSpinnerSampler (may have out of domain
-    // particles)
-    if (std::all_of(samplers.cbegin(), samplers.cend(), [](const auto& probe) {
-            return probe->sampletype() != "DTUSpinnerSampler";
-        })) {
-        AMREX_ALWAYS_ASSERT(m_total_particles == TotalNumberOfParticles(false));
+    amrex::Gpu::streamSynchronize();
+
+    Redistribute();
+    m_stencils.clear();
+
+    return TotalNumberOfParticles() == m_total_particles;
+}
+
+const InterpStencil* SamplingContainer::stencils(
+    const ParIterType& pti, const int lev, const FieldLoc floc)
+{
+    const auto key = std::make_tuple(
+        lev, pti.index(), pti.LocalTileIndex(), static_cast<int>(floc));
+    const int np = pti.numParticles();
+    const auto it = m_stencils.find(key);
+    if (it != m_stencils.end()) {
+        AMREX_ASSERT(static_cast<int>(it->second.size()) == np);
+        return it->second.data();
     }
+
+    BL_PROFILE("amr-wind::SamplingContainer::stencils");
+    auto& st = m_stencils[key];
+    const auto& geom = m_mesh.Geom(lev);
+    const auto dx = geom.CellSizeArray();
+    const auto dxi = geom.InvCellSizeArray();
+    const auto plo = geom.ProbLoArray();
+    const auto offset = field_offset(floc);
+
+    st.resize(np);
+    auto* p_st = st.data();
+    const auto* pstruct = pti.GetArrayOfStructs()().data();
+    amrex::ParallelFor(np, [=] AMREX_GPU_DEVICE(const int ip) noexcept {
+        p_st[ip] = compute_stencil(pstruct[ip].pos(), plo, dxi, dx, offset);
+    });
+    return st.data();
 }
 
 void SamplingContainer::interpolate_derived_fields(
@@ -146,6 +257,11 @@ void SamplingContainer::interpolate_derived_fields(
 {
     BL_PROFILE("amr-wind::SamplingContainer::interpolate_derived_fields");
 
+    if (derived_mgr.has_cell_evaluation()) {
+        interpolate_derived_cells(derived_mgr, scomp);
+        return;
+    }
+
     auto outfield = repo.create_scratch_field(derived_mgr.num_comp(), 1);
     derived_mgr(*outfield, 0);
 
@@ -161,37 +277,332 @@ void SamplingContainer::interpolate_derived_fields(
     }
 }
 
-void SamplingContainer::populate_buffer(std::vector<double>& buf)
+void SamplingContainer::interpolate_derived_cells(
+    const DerivedQtyMgr& derived_mgr, const int scomp)
 {
-    BL_PROFILE("amr-wind::SamplingContainer::populate_buffer");
+    BL_PROFILE("amr-wind::SamplingContainer::interpolate_derived_cells");
 
-    amrex::Gpu::DeviceVector<double> dbuf(buf.size(), 0.0);
-    auto* dbuf_ptr = dbuf.data();
+    // Number of cells in the trilinear interpolation stencil
+    constexpr int ncorners = 8;
+    const int ncomp = derived_mgr.num_comp();
     const int nlevels = m_mesh.finestLevel() + 1;
+
     for (int lev = 0; lev < nlevels; ++lev) {
-        for (int fid = 0; fid < NumRuntimeRealComps(); ++fid) {
-            const long offset = fid * num_sampling_particles();
-            for (ParIterType pti(*this, lev); pti.isValid(); ++pti) {
-                const int np = pti.numParticles();
-                auto* pstruct = pti.GetArrayOfStructs()().data();
-                auto* parr = pti.GetStructOfArrays().GetRealData(fid).data();
+        // Stencils reaching outside non-periodic boundaries are shifted
+        // inwards and linearly extrapolate from the interior cells, which
+        // approximates the extrapolation used to fill the ghost cells of
+        // the derived fields
+        const auto& geom = m_mesh.Geom(lev);
+        const auto& domain = geom.Domain();
+        const amrex::IntVect clo = domain.smallEnd();
+        const amrex::IntVect chi =
+            domain.bigEnd() - amrex::IntVect::TheUnitVector();
+        amrex::IntVect bounded(0);
+        for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+            bounded[d] = geom.isPeriodic(d) ? 0 : 1;
+        }
+
+        for (ParIterType pti(*this, lev); pti.isValid(); ++pti) {
+            const int np = pti.numParticles();
+            if (np == 0) {
+                continue;
+            }
+
+            const auto* p_st = stencils(pti, lev, FieldLoc::CELL);
+            amrex::Gpu::DeviceVector<InterpStencil> dst(np);
+            amrex::Gpu::DeviceVector<amrex::IntVect> cells(np * ncorners);
+            auto* p_dst = dst.data();
+            auto* p_cells = cells.data();
+            amrex::ParallelFor(
+                np, [=] AMREX_GPU_DEVICE(const int ip) noexcept {
+                    auto st = p_st[ip];
+                    for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+                        if (bounded[d] == 0) {
+                            continue;
+                        }
+                        const int shift = amrex::max(clo[d] - st.iv[d], 0) -
+                                          amrex::max(st.iv[d] - chi[d], 0);
+                        st.iv[d] += shift;
+                        st.whi[d] -= shift;
+                    }
+                    p_dst[ip] = st;
+                    for (int n = 0; n < ncorners; ++n) {
+                        p_cells[ip * ncorners + n] =
+                            st.iv + amrex::IntVect(AMREX_D_DECL(
+                                        (n >> 2) & 1, (n >> 1) & 1, n & 1));
+                    }
+                });
+
+            const int ncells = np * ncorners;
+            amrex::Gpu::DeviceVector<amrex::Real> vals(
+                static_cast<size_t>(ncells) * ncomp);
+            derived_mgr.evaluate_cells(
+                lev, pti, p_cells, ncells, vals.data());
+            const auto* p_vals = vals.data();
 
+            amrex::Vector<amrex::Real*> comps(ncomp);
+            for (int ic = 0; ic < ncomp; ++ic) {
+                comps[ic] =
+                    pti.GetStructOfArrays().GetRealData(scomp + ic).data();
+            }
+            amrex::Gpu::DeviceVector<amrex::Real*> dcomps(ncomp);
+            amrex::Gpu::copy(
+                amrex::Gpu::hostToDevice, comps.begin(), comps.end(),
+                dcomps.begin());
+            auto* const* p_comps = dcomps.data();
+
+            amrex::ParallelFor(
+                np, [=] AMREX_GPU_DEVICE(const int ip) noexcept {
+                    const auto& st = p_dst[ip];
+                    for (int ic = 0; ic < ncomp; ++ic) {
+                        amrex::Real val = 0.0;
+                        for (int n = 0; n < ncorners; ++n) {
+                            const amrex::Real wx = ((n >> 2) & 1) != 0
+                                                       ? st.whi[0]
+                                                       : 1.0 - st.whi[0];
+                            const amrex::Real wy = ((n >> 1) & 1) != 0
+                                                       ? st.whi[1]
+                                                       : 1.0 - st.whi[1];
+                            const amrex::Real wz =
+                                (n & 1) != 0 ? st.whi[2] : 1.0 - st.whi[2];
+                            val += wx * wy * wz *
+                                   p_vals[(ip * ncorners + n) * ncomp + ic];
+                        }
+                        p_comps[ic][ip] = val;
+                    }
+                });
+            amrex::Gpu::streamSynchronize();
+        }
+    }
+}
+
+long SamplingContainer::pack_records(std::vector<double>& records)
+{
+    BL_PROFILE("amr-wind::SamplingContainer::pack_records");
+
+    const int nvars = NumRuntimeRealComps();
+    const int nrec = nvars + 1;
+    const int nlevels = m_mesh.finestLevel() + 1;
+
+    long nlocal = 0;
+    for (int lev = 0; lev < nlevels; ++lev) {
+        for (ParIterType pti(*this, lev); pti.isValid(); ++pti) {
+            nlocal += pti.numParticles();
+        }
+    }
+
+    amrex::Gpu::DeviceVector<double> dsend(nlocal * nrec);
+    auto* dsend_ptr = dsend.data();
+    long poffset = 0;
+    for (int lev = 0; lev < nlevels; ++lev) {
+        for (ParIterType pti(*this, lev); pti.isValid(); ++pti) {
+            const int np = pti.numParticles();
+            auto* pstruct = pti.GetArrayOfStructs()().data();
+            auto* prec = dsend_ptr + poffset * nrec;
+            amrex::ParallelFor(
+                np, [=] AMREX_GPU_DEVICE(const int ip) noexcept {
+                    prec[ip * nrec] =
+                        static_cast<double>(pstruct[ip].idata(IIx::uid));
+                });
+            for (int fid = 0; fid < nvars; ++fid) {
+                auto* parr = pti.GetStructOfArrays().GetRealData(fid).data();
                 amrex::ParallelFor(
                     np, [=] AMREX_GPU_DEVICE(const int ip) noexcept {
-                        auto& pp = pstruct[ip];
-                        const int pidx = pp.idata(IIx::uid);
-                        const long ii = offset + pidx;
-                        dbuf_ptr[ii] = parr[ip];
+                        prec[ip * nrec + 1 + fid] = parr[ip];
                     });
             }
+            poffset += np;
         }
     }
 
+    const auto roffset = static_cast<long>(records.size());
+    records.resize(roffset + dsend.size());
     amrex::Gpu::copy(
-        amrex::Gpu::deviceToHost, dbuf.begin(), dbuf.end(), buf.begin());
-    amrex::ParallelDescriptor::ReduceRealSum(
-        buf.data(), static_cast<int>(buf.size()),
-        amrex::ParallelDescriptor::IOProcessorNumber());
+        amrex::Gpu::deviceToHost, dsend.begin(), dsend.end(),
+        records.begin() + roffset);
+    return nlocal;
+}
+
+void SamplingContainer::populate_buffer(std::vector<double>& buf)
+{
+    BL_PROFILE("amr-wind::SamplingContainer::populate_buffer");
+
+    std::vector<double> records;
+    const long nlocal = pack_records(records);
+    populate_buffer(records, {nlocal}, buf);
+}
+
+void SamplingContainer::populate_buffer(
+    const std::vector<double>& records,
+    const std::vector<long>& nlocal,
+    std::vector<double>& buf)
+{
+    BL_PROFILE("amr-wind::SamplingContainer::populate_buffer");
+
+    // Each rank packs the UID and the sampled values of its particles as
+    // records of (uid, var_0, ..., var_n) that are gathered on the IO
+    // processor, so the communication scales with the number of particles
+    // rather than with the number of particles times the number of ranks.
+    const int nvars = NumRuntimeRealComps();
+    const int nrec = nvars + 1;
+    const int nsteps = static_cast<int>(nlocal.size());
+
+    const int ioproc = amrex::ParallelDescriptor::IOProcessorNumber();
+    const bool is_io = amrex::ParallelDescriptor::IOProcessor();
+    const int nprocs = amrex::ParallelDescriptor::NProcs();
+
+    // Number of records of each time step on every rank
+    const std::vector<int> send_nrec(nlocal.begin(), nlocal.end());
+    std::vector<int> recv_nrec(is_io ? nprocs * nsteps : 0, 0);
+    amrex::ParallelDescriptor::Gather(
+        send_nrec.data(), nsteps, recv_nrec.data(), nsteps, ioproc);
+
+    const int send_count = static_cast<int>(records.size());
+    std::vector<int> recv_counts(nprocs, 0);
+    std::vector<int> displs(nprocs, 0);
+    long nrecv = 0;
+    if (is_io) {
+        for (int ip = 0; ip < nprocs; ++ip) {
+            for (int is = 0; is < nsteps; ++is) {
+                recv_counts[ip] += recv_nrec[ip * nsteps + is] * nrec;
+            }
+            displs[ip] = static_cast<int>(nrecv);
+            nrecv += recv_counts[ip];
+        }
+        AMREX_ALWAYS_ASSERT(nrecv <= std::numeric_limits<int>::max());
+    }
+
+    std::vector<double> recv(nrecv);
+    amrex::ParallelDescriptor::Gatherv(
+        records.data(), send_count, recv.data(), recv_counts, displs, ioproc);
+
+    if (!is_io) {
+        return;
+    }
+
+    // Reorder the records by time step and UID
+    const long ntotal = num_sampling_particles();
+    buf.assign(nsteps * nvars * ntotal, 0.0);
+    const double* rec = recv.data();
+    for (int ip = 0; ip < nprocs; ++ip) {
+        for (int is = 0; is < nsteps; ++is) {
+            double* sbuf = &buf[is * nvars * ntotal];
+            for (int ir = 0; ir < recv_nrec[ip * nsteps + is]; ++ir) {
+                const auto uid = static_cast<long>(rec[0]);
+                for (int fid = 0; fid < nvars; ++fid) {
+                    sbuf[fid * ntotal + uid] = rec[1 + fid];
+                }
+                rec += nrec;
+            }
+        }
+    }
+}
+
+std::pair<long, long>
+SamplingContainer::populate_block_buffer(std::vector<double>& buf)
+{
+    BL_PROFILE("amr-wind::SamplingContainer::populate_block_buffer");
+
+    std::vector<double> records;
+    const long nlocal = pack_records(records);
+    return populate_block_buffer(records, {nlocal}, buf);
+}
+
+std::pair<long, long> SamplingContainer::populate_block_buffer(
+    const std::vector<double>& records,
+    const std::vector<long>& nlocal,
+    std::vector<double>& buf)
+{
+    BL_PROFILE("amr-wind::SamplingContainer::populate_block_buffer");
+
+    const int nvars = NumRuntimeRealComps();
+    const int nrec = nvars + 1;
+    const int nsteps = static_cast<int>(nlocal.size());
+    const int nprocs = amrex::ParallelDescriptor::NProcs();
+    const int iproc = amrex::ParallelDescriptor::MyProc();
+    const long ntotal = num_sampling_particles();
+    const long nrecords = std::accumulate(nlocal.begin(), nlocal.end(), 0L);
+
+    // Sort the records by the processor owning their UID, keeping the
+    // records of each processor ordered by time step
+    std::vector<int> send_nrec(nprocs * nsteps, 0);
+    std::vector<int> send_counts(nprocs, 0);
+    std::vector<int> dest(nrecords);
+    {
+        long ir = 0;
+        for (int is = 0; is < nsteps; ++is) {
+            for (long n = 0; n < nlocal[is]; ++n, ++ir) {
+                const auto uid = static_cast<long>(records[ir * nrec]);
+                dest[ir] = uid_block_owner(uid, ntotal, nprocs);
+                ++send_nrec[dest[ir] * nsteps + is];
+                send_counts[dest[ir]] += nrec;
+            }
+        }
+    }
+
+    std::vector<int> send_displs(nprocs, 0);
+    for (int ip = 1; ip < nprocs; ++ip) {
+        send_displs[ip] = send_displs[ip - 1] + send_counts[ip - 1];
+    }
+
+    std::vector<double> send(records.size());
+    {
+        auto pos = send_displs;
+        for (long ir = 0; ir < nrecords; ++ir) {
+            std::copy(
+                &records[ir * nrec], &records[ir * nrec] + nrec,
+                &send[pos[dest[ir]]]);
+            pos[dest[ir]] += nrec;
+        }
+    }
+
+    std::vector<int> recv_nrec(nprocs * nsteps, 0);
+    std::vector<double> recv;
+#ifdef AMREX_USE_MPI
+    const auto comm = amrex::ParallelDescriptor::Communicator();
+    MPI_Alltoall(
+        send_nrec.data(), nsteps, MPI_INT, recv_nrec.data(), nsteps, MPI_INT,
+        comm);
+    std::vector<int> recv_counts(nprocs, 0);
+    std::vector<int> recv_displs(nprocs, 0);
+    for (int ip = 0; ip < nprocs; ++ip) {
+        for (int is = 0; is < nsteps; ++is) {
+            recv_counts[ip] += recv_nrec[ip * nsteps + is] * nrec;
+        }
+        if (ip > 0) {
+            recv_displs[ip] = recv_displs[ip - 1] + recv_counts[ip - 1];
+        }
+    }
+    recv.resize(recv_displs[nprocs - 1] + recv_counts[nprocs - 1]);
+    MPI_Alltoallv(
+        send.data(), send_counts.data(), send_displs.data(), MPI_DOUBLE,
+        recv.data(), recv_counts.data(), recv_displs.data(), MPI_DOUBLE,
+        comm);
+#else
+    recv_nrec = send_nrec;
+    recv = std::move(send);
+#endif
+
+    // Reorder the records by time step and UID within the block of this
+    // processor
+    const long start = uid_block_start(iproc, ntotal, nprocs);
+    const long count = uid_block_start(iproc + 1, ntotal, nprocs) - start;
+    buf.assign(nsteps * count * nvars, 0.0);
+    const double* rec = recv.data();
+    for (int ip = 0; ip < nprocs; ++ip) {
+        for (int is = 0; is < nsteps; ++is) {
+            double* sbuf = &buf[is * nvars * count];
+            for (int ir = 0; ir < recv_nrec[ip * nsteps + is]; ++ir) {
+                const long idx = static_cast<long>(rec[0]) - start;
+                for (int fid = 0; fid < nvars; ++fid) {
+                    sbuf[fid * count + idx] = rec[1 + fid];
+                }
+                rec += nrec;
+            }
+        }
+    }
+
+    return {start, count};
 }
 
 } // namespace amr_wind::sampling
@@ -46,12 +46,6 @@ vs::Vector canon_rotator(const vs::Vector& angles, const vs::Vector& data)
     return data & rotMatrix;
 }
 
-vs::Tensor unit_projection_matrix(const vs::Vector& a)
-{
-    return {a[0] * a[0], a[0] * a[1], a[0] * a[2], a[0] * a[1], a[1] * a[1],
-            a[1] * a[2], a[0] * a[2], a[1] * a[2], a[2] * a[2]};
-}
-
 vs::Tensor rotation_matrix(vs::Vector dst, vs::Vector src)
 {
     auto vmat = skew_cross(dst, src);
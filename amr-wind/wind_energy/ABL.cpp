@@ -159,7 +159,11 @@ void ABL::post_init_actions()
     m_abl_anelastic->post_init_actions();
 }
 
-void ABL::post_regrid_actions() { m_abl_anelastic->post_regrid_actions(); }
+void ABL::post_regrid_actions()
+{
+    m_bndry_plane->post_regrid_actions();
+    m_abl_anelastic->post_regrid_actions();
+}
 
 /** Perform tasks at the beginning of a new timestep
  *
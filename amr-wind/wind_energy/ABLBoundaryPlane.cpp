@@ -8,6 +8,8 @@
 #include "amr-wind/utilities/constants.H"
 #include <AMReX_PlotFileUtil.H>
 
+#include <numeric>
+
 namespace amr_wind {
 
 namespace {
@@ -39,6 +41,35 @@ AMREX_FORCE_INLINE std::string level_name(int lev)
 }
 #endif
 
+//! Extend a box by the part of a plane needed by the grids of this rank
+void add_local_grids(
+    const amrex::BoxArray& ba,
+    const amrex::DistributionMapping& dm,
+    const amrex::IntVect& rr,
+    const int ngrow,
+    const amrex::Box& pbx,
+    amrex::Box& lbx)
+{
+    const int myproc = amrex::ParallelDescriptor::MyProc();
+    for (int i = 0; i < static_cast<int>(ba.size()); ++i) {
+        if (dm[i] != myproc) {
+            continue;
+        }
+        const auto cc_bx =
+            amrex::convert(ba[i], amrex::IndexType::TheCellType());
+        const auto cbx = amrex::coarsen(amrex::grow(cc_bx, ngrow), rr);
+        const auto bx = amrex::grow(cbx, ngrow) & pbx;
+        if (bx.isEmpty()) {
+            continue;
+        }
+        if (lbx.isEmpty()) {
+            lbx = bx;
+        } else {
+            lbx.minBox(bx);
+        }
+    }
+}
+
 } // namespace
 
 void InletData::resize(const int size)
@@ -46,6 +77,7 @@ void InletData::resize(const int size)
     m_data_n.resize(size);
     m_data_np1.resize(size);
     m_data_interp.resize(size);
+    m_plane_boxes.resize(size);
 }
 
 void InletData::define_plane(const amrex::Orientation ori)
@@ -57,162 +89,261 @@ void InletData::define_plane(const amrex::Orientation ori)
 
 void InletData::define_level_data(
     const amrex::Orientation ori, const amrex::Box& bx, const size_t nc)
+{
+    define_level_data(ori, bx, bx, nc);
+}
+
+void InletData::define_level_data(
+    const amrex::Orientation ori,
+    const amrex::Box& plane_bx,
+    const amrex::Box& bx,
+    const size_t nc)
 {
     if (!this->is_populated(ori)) {
         return;
     }
+    m_plane_boxes[ori].push_back(plane_bx);
     m_data_n[ori]->push_back(amrex::FArrayBox(bx, static_cast<int>(nc)));
     m_data_np1[ori]->push_back(amrex::FArrayBox(bx, static_cast<int>(nc)));
     m_data_interp[ori]->push_back(amrex::FArrayBox(bx, static_cast<int>(nc)));
 }
 
-#ifdef AMR_WIND_USE_NETCDF
-void InletData::read_data(
-    ncutils::NCGroup& grp,
-    const amrex::Orientation ori,
-    const int lev,
-    const Field* fld,
-    const amrex::Real time,
-    const amrex::Vector<amrex::Real>& times)
+void InletData::redefine_level_data(
+    const amrex::Orientation ori, const int lev, const amrex::Box& bx)
 {
-    const size_t nc = fld->num_comp();
-    const int nstart = m_components[static_cast<int>(fld->id())];
+    const int nc = (*m_data_n[ori])[lev].nComp();
+    (*m_data_n[ori])[lev] = amrex::FArrayBox(bx, nc);
+    (*m_data_np1[ori])[lev] = amrex::FArrayBox(bx, nc);
+    (*m_data_interp[ori])[lev] = amrex::FArrayBox(bx, nc);
+
+    // The prefetch buffers are allocated again by the next start_prefetch
+    m_data_prefetch.clear();
+    m_idx_prefetch = -1;
+    m_nprefetch = 0;
+}
 
+bool InletData::advance_window(
+    const amrex::Real time, const amrex::Vector<amrex::Real>& times)
+{
     const int idx = utils::closest_index(times, time, constants::LOOSE_TOL);
     const int idxp1 = idx + 1;
-    m_tn = times[idx];
-    m_tnp1 = times[idxp1];
-    if (!((m_tn <= time + constants::LOOSE_TOL) &&
-          (time <= m_tnp1 + constants::LOOSE_TOL))) {
+    if (!((times[idx] <= time + constants::LOOSE_TOL) &&
+          (time <= times[idxp1] + constants::LOOSE_TOL))) {
         amrex::Abort(
-            "ABLBoundaryPlane.cpp InletData::read_data() check failed\n"
+            "ABLBoundaryPlane.cpp InletData::advance_window() check failed\n"
             "Left time quantities should be <= right time quantities. Indices "
             "supplied for debugging.\n"
             "m_tn = " +
-            std::to_string(m_tn) + ", time + LOOSE_TOL = " +
+            std::to_string(times[idx]) + ", time + LOOSE_TOL = " +
             std::to_string(time + constants::LOOSE_TOL) +
             "\n"
             "time = " +
             std::to_string(time) + ", m_tnp1 + LOOSE_TOL = " +
-            std::to_string(m_tnp1 + constants::LOOSE_TOL) +
+            std::to_string(times[idxp1] + constants::LOOSE_TOL) +
             "\n"
             "idx = " +
             std::to_string(idx) + ", idxp1 = " + std::to_string(idxp1));
     }
 
+    // In the usual forward march the planes at n + 1 are the new planes at
+    // n, so the buffers are swapped instead of reading them again
+    const bool slide = (m_idx_n >= 0) && (idx == m_idx_n + 1);
+    if (slide) {
+        std::swap(m_data_n, m_data_np1);
+    }
+
+    m_idx_n = idx;
+    m_tn = times[idx];
+    m_tnp1 = times[idxp1];
+    return !slide;
+}
+
+#ifdef AMR_WIND_USE_NETCDF
+void InletData::read_host_data(
+    ncutils::NCGroup& grp,
+    const amrex::Orientation ori,
+    const int lev,
+    const Field* fld,
+    const int idx,
+    const amrex::Vector<amrex::FArrayBox*>& h_dats) const
+{
+    const size_t nc = fld->num_comp();
+    const int nstart = m_components.at(static_cast<int>(fld->id()));
+
     const int normal = ori.coordDir();
     const amrex::GpuArray<int, 2> perp = utils::perpendicular_idx(normal);
 
-    const auto& bx = (*m_data_n[ori])[lev].box();
+    const auto& bx = h_dats[0]->box();
     const auto& lo = bx.loVect();
+    const auto& plo = m_plane_boxes[ori][lev].loVect();
     const size_t n0 = bx.length(perp[0]);
     const size_t n1 = bx.length(perp[1]);
 
-    // start counting at zero because of netcdf indexing
+    // Read the part of the plane covered by the array, counting from zero
+    // because of netcdf indexing
     amrex::Vector<size_t> start{
-        static_cast<size_t>(idx), static_cast<size_t>(0),
-        static_cast<size_t>(0), 0};
-    amrex::Vector<size_t> count{1, n0, n1, nc};
-    amrex::Vector<amrex::Real> buffer(n0 * n1 * nc);
+        static_cast<size_t>(idx),
+        static_cast<size_t>(lo[perp[0]] - plo[perp[0]]),
+        static_cast<size_t>(lo[perp[1]] - plo[perp[1]]), 0};
+    const size_t nrec = h_dats.size();
+    amrex::Vector<size_t> count{nrec, n0, n1, nc};
+    const size_t rec_size = n0 * n1 * nc;
+    amrex::Vector<amrex::Real> buffer(nrec * rec_size);
     grp.var(fld->name()).get(buffer.data(), start, count);
 
-    amrex::FArrayBox h_datn(
-        bx, (*m_data_n[ori])[lev].nComp(), amrex::The_Pinned_Arena());
-    const auto& h_datn_arr = h_datn.array();
-    auto* d_buffer = buffer.dataPtr();
-    amrex::LoopOnCpu(
-        bx, static_cast<int>(nc), [=](int i, int j, int k, int n) noexcept {
-            const int i0 = plane_idx(i, j, k, perp[0], lo[perp[0]]);
-            const int i1 = plane_idx(i, j, k, perp[1], lo[perp[1]]);
-            h_datn_arr(i, j, k, n + nstart) =
-                d_buffer[((i0 * n1) + i1) * nc + n];
-        });
+    for (size_t r = 0; r < nrec; ++r) {
+        const auto& h_dat_arr = h_dats[r]->array();
+        auto* d_buffer = buffer.dataPtr() + r * rec_size;
+        amrex::LoopOnCpu(
+            bx, static_cast<int>(nc),
+            [=](int i, int j, int k, int n) noexcept {
+                const int i0 = plane_idx(i, j, k, perp[0], lo[perp[0]]);
+                const int i1 = plane_idx(i, j, k, perp[1], lo[perp[1]]);
+                h_dat_arr(i, j, k, n + nstart) =
+                    d_buffer[((i0 * n1) + i1) * nc + n];
+            });
+    }
+}
 
-    start[0] = static_cast<size_t>(idxp1);
-    grp.var(fld->name()).get(buffer.data(), start, count);
+void InletData::read_data(
+    ncutils::NCGroup& grp,
+    const amrex::Orientation ori,
+    const int lev,
+    const Field* fld,
+    const bool is_np1)
+{
+    const size_t nc = fld->num_comp();
+    const int nstart = m_components[static_cast<int>(fld->id())];
+    const int idx = is_np1 ? m_idx_n + 1 : m_idx_n;
+    auto& dat = plane_data(ori, is_np1)[lev];
 
-    amrex::FArrayBox h_datnp1(
-        bx, (*m_data_np1[ori])[lev].nComp(), amrex::The_Pinned_Arena());
-    const auto& h_datnp1_arr = h_datnp1.array();
-    amrex::LoopOnCpu(
-        bx, static_cast<int>(nc), [=](int i, int j, int k, int n) noexcept {
-            const int i0 = plane_idx(i, j, k, perp[0], lo[perp[0]]);
-            const int i1 = plane_idx(i, j, k, perp[1], lo[perp[1]]);
-            h_datnp1_arr(i, j, k, n + nstart) =
-                d_buffer[((i0 * n1) + i1) * nc + n];
-        });
+    amrex::FArrayBox h_dat(dat.box(), dat.nComp(), amrex::The_Pinned_Arena());
+    read_host_data(grp, ori, lev, fld, idx, {&h_dat});
 
-    const auto nelems = bx.numPts() * nc;
-    amrex::Gpu::copyAsync(
-        amrex::Gpu::hostToDevice, h_datn.dataPtr(nstart),
-        h_datn.dataPtr(nstart) + nelems, (*m_data_n[ori])[lev].dataPtr(nstart));
+    const auto nelems = dat.box().numPts() * nc;
     amrex::Gpu::copyAsync(
-        amrex::Gpu::hostToDevice, h_datnp1.dataPtr(nstart),
-        h_datnp1.dataPtr(nstart) + nelems,
-        (*m_data_np1[ori])[lev].dataPtr(nstart));
+        amrex::Gpu::hostToDevice, h_dat.dataPtr(nstart),
+        h_dat.dataPtr(nstart) + nelems, dat.dataPtr(nstart));
+    amrex::Gpu::streamSynchronize();
+}
+
+void InletData::read_data(
+    ncutils::NCGroup& grp,
+    const amrex::Orientation ori,
+    const int lev,
+    const Field* fld,
+    const amrex::Real time,
+    const amrex::Vector<amrex::Real>& times)
+{
+    advance_window(time, times);
+    read_data(grp, ori, lev, fld, false);
+    read_data(grp, ori, lev, fld, true);
+}
+
+void InletData::start_prefetch(const int idx, const int nrec)
+{
+    AMREX_ALWAYS_ASSERT((idx >= 0) && (nrec > 0));
+
+    // The buffers are kept for the next records unless more are needed
+    if (static_cast<int>(m_data_prefetch.size()) < nrec) {
+        m_data_prefetch.resize(nrec);
+        for (auto& h_rec : m_data_prefetch) {
+            if (!h_rec.empty()) {
+                continue;
+            }
+            h_rec.resize(m_data_n.size());
+            for (amrex::OrientationIter oit; oit != nullptr; ++oit) {
+                auto ori = oit();
+                if (!this->is_populated(ori)) {
+                    continue;
+                }
+                h_rec[ori] = std::make_unique<PlaneVector>();
+                for (const auto& dat : *m_data_n[ori]) {
+                    h_rec[ori]->push_back(amrex::FArrayBox(
+                        dat.box(), dat.nComp(), amrex::The_Pinned_Arena()));
+                    h_rec[ori]->back().setVal<amrex::RunOn::Host>(0.0);
+                }
+            }
+        }
+    }
+    m_idx_prefetch = idx;
+    m_nprefetch = nrec;
+}
+
+void InletData::prefetch(
+    ncutils::NCGroup& grp,
+    const amrex::Orientation ori,
+    const int lev,
+    const Field* fld)
+{
+    AMREX_ALWAYS_ASSERT(m_idx_prefetch >= 0);
+    amrex::Vector<amrex::FArrayBox*> h_dats(m_nprefetch);
+    for (int r = 0; r < m_nprefetch; ++r) {
+        h_dats[r] = &(*m_data_prefetch[r][ori])[lev];
+    }
+    read_host_data(grp, ori, lev, fld, m_idx_prefetch, h_dats);
+}
+
+bool InletData::use_prefetch(const int idx, const bool is_np1)
+{
+    if (!is_prefetched(idx)) {
+        return false;
+    }
+
+    const auto& h_rec = m_data_prefetch[idx - m_idx_prefetch];
+    for (amrex::OrientationIter oit; oit != nullptr; ++oit) {
+        auto ori = oit();
+        if (h_rec[ori] == nullptr) {
+            continue;
+        }
+
+        const auto& h_data = *h_rec[ori];
+        auto& data = plane_data(ori, is_np1);
+        for (int lev = 0; lev < static_cast<int>(h_data.size()); ++lev) {
+            amrex::Gpu::copyAsync(
+                amrex::Gpu::hostToDevice, h_data[lev].dataPtr(),
+                h_data[lev].dataPtr() + h_data[lev].size(),
+                data[lev].dataPtr());
+        }
+    }
     amrex::Gpu::streamSynchronize();
+    return true;
 }
 
 #endif
 
 void InletData::read_data_native(
     const amrex::OrientationIter oit,
-    amrex::BndryRegister& bndry_n,
-    amrex::BndryRegister& bndry_np1,
+    amrex::BndryRegister& bndry,
     const int lev,
     const Field* fld,
-    const amrex::Real time,
-    const amrex::Vector<amrex::Real>& times)
+    const bool is_np1)
 {
     const size_t nc = fld->num_comp();
     const int nstart =
         static_cast<int>(m_components[static_cast<int>(fld->id())]);
 
-    const int idx = utils::closest_index(times, time, constants::LOOSE_TOL);
-    const int idxp1 = idx + 1;
-
-    m_tn = times[idx];
-    m_tnp1 = times[idxp1];
-
     auto ori = oit();
 
-    if (!(m_tn <= time + constants::LOOSE_TOL) ||
-        !(time <= m_tnp1 + constants::LOOSE_TOL)) {
-        amrex::Abort(
-            "ABLBoundaryPlane.cpp InletData::read_data_native() check "
-            "failed\n"
-            "Left time quantities should be <= right time quantities. Indices "
-            "supplied for debugging.\n"
-            "m_tn = " +
-            std::to_string(m_tn) + ", time + LOOSE_TOL = " +
-            std::to_string(time + constants::LOOSE_TOL) +
-            "\n"
-            "time = " +
-            std::to_string(time) + ", m_tnp1 + LOOSE_TOL = " +
-            std::to_string(m_tnp1 + constants::LOOSE_TOL) +
-            "\n"
-            "idx = " +
-            std::to_string(idx) + ", idxp1 = " + std::to_string(idxp1));
-    }
-    AMREX_ALWAYS_ASSERT(fld->num_comp() == bndry_n[ori].nComp());
-    AMREX_ASSERT(bndry_n[ori].boxArray() == bndry_np1[ori].boxArray());
+    AMREX_ALWAYS_ASSERT(fld->num_comp() == bndry[ori].nComp());
 
     const int normal = ori.coordDir();
-    const auto& bbx = (*m_data_n[ori])[lev].box();
+    auto& dat = plane_data(ori, is_np1)[lev];
+    const auto& bbx = dat.box();
     const amrex::IntVect v_offset = offset(ori.faceDir(), normal);
 
-    amrex::MultiFab bndry(
-        bndry_n[ori].boxArray(), bndry_n[ori].DistributionMap(),
-        bndry_n[ori].nComp(), 0, amrex::MFInfo());
+    amrex::MultiFab bndry_mf(
+        bndry[ori].boxArray(), bndry[ori].DistributionMap(),
+        bndry[ori].nComp(), 0, amrex::MFInfo());
 
 #ifdef AMREX_USE_OMP
 #pragma omp parallel if (false)
 #endif
-    for (amrex::MFIter mfi(bndry); mfi.isValid(); ++mfi) {
+    for (amrex::MFIter mfi(bndry_mf); mfi.isValid(); ++mfi) {
 
         const auto& vbx = mfi.validbox();
-        const auto& bndry_n_arr = bndry_n[ori].array(mfi);
-        const auto& bndry_arr = bndry.array(mfi);
+        const auto& bndry_arr = bndry[ori].array(mfi);
+        const auto& bndry_mf_arr = bndry_mf.array(mfi);
 
         const auto& bx = bbx & vbx;
         if (bx.isEmpty()) {
@@ -221,40 +352,29 @@ void InletData::read_data_native(
 
         amrex::ParallelFor(
             bx, nc, [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
-                bndry_arr(i, j, k, n) =
+                bndry_mf_arr(i, j, k, n) =
                     0.5 *
-                    (bndry_n_arr(i, j, k, n) +
-                     bndry_n_arr(
+                    (bndry_arr(i, j, k, n) +
+                     bndry_arr(
                          i + v_offset[0], j + v_offset[1], k + v_offset[2], n));
             });
     }
 
-    bndry.copyTo((*m_data_n[ori])[lev], 0, nstart, static_cast<int>(nc));
-
-#ifdef AMREX_USE_OMP
-#pragma omp parallel if (false)
-#endif
-    for (amrex::MFIter mfi(bndry); mfi.isValid(); ++mfi) {
-        const auto& vbx = mfi.validbox();
-        const auto& bndry_np1_arr = bndry_np1[ori].array(mfi);
-        const auto& bndry_arr = bndry.array(mfi);
-
-        const auto& bx = bbx & vbx;
-        if (bx.isEmpty()) {
-            continue;
-        }
-
-        amrex::ParallelFor(
-            bx, nc, [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
-                bndry_arr(i, j, k, n) =
-                    0.5 *
-                    (bndry_np1_arr(i, j, k, n) +
-                     bndry_np1_arr(
-                         i + v_offset[0], j + v_offset[1], k + v_offset[2], n));
-            });
-    }
+    bndry_mf.copyTo(dat, 0, nstart, static_cast<int>(nc));
+}
 
-    bndry.copyTo((*m_data_np1[ori])[lev], 0, nstart, static_cast<int>(nc));
+void InletData::read_data_native(
+    const amrex::OrientationIter oit,
+    amrex::BndryRegister& bndry_n,
+    amrex::BndryRegister& bndry_np1,
+    const int lev,
+    const Field* fld,
+    const amrex::Real time,
+    const amrex::Vector<amrex::Real>& times)
+{
+    advance_window(time, times);
+    read_data_native(oit, bndry_n, lev, fld, false);
+    read_data_native(oit, bndry_np1, lev, fld, true);
 }
 
 void InletData::interpolate(const amrex::Real time)
@@ -315,8 +435,28 @@ ABLBoundaryPlane::ABLBoundaryPlane(CFDSim& sim)
     pp.queryarr("bndry_var_names", m_var_names);
     pp.get("bndry_file", m_filename);
     pp.query("bndry_output_format", m_out_fmt);
-
-#ifndef AMR_WIND_USE_NETCDF
+    pp.query("bndry_prefetch", m_prefetch);
+    pp.query("bndry_prefetch_records", m_prefetch_records);
+    pp.query("bndry_local_reads", m_local_reads);
+    if (m_prefetch && (m_out_fmt != "netcdf")) {
+        amrex::Print() << "WARNING: ABLBoundaryPlane: bndry_prefetch is only "
+                          "supported with the netcdf format, ignoring"
+                       << std::endl;
+        m_prefetch = false;
+    }
+    if (m_prefetch && (m_prefetch_records < 2)) {
+        amrex::Abort(
+            "ABLBoundaryPlane: bndry_prefetch_records must be at least 2");
+    }
+    if (m_local_reads && (m_out_fmt != "netcdf")) {
+        amrex::Print() << "WARNING: ABLBoundaryPlane: bndry_local_reads is "
+                          "only supported with the netcdf format, ignoring"
+                       << std::endl;
+        m_local_reads = false;
+    }
+#ifdef AMR_WIND_USE_NETCDF
+    ioutils::query_netcdf_options(pp, "bndry_", m_nc_opts);
+#else
     if (m_out_fmt == "netcdf") {
         amrex::Print()
             << "Warning: boundary output format using netcdf must link netcdf "
@@ -374,6 +514,29 @@ void ABLBoundaryPlane::post_advance_work()
     write_file();
 }
 
+void ABLBoundaryPlane::post_regrid_actions()
+{
+    if (!m_is_initialized || (m_io_mode != io_mode::input) ||
+        !m_local_reads) {
+        return;
+    }
+
+#ifdef AMR_WIND_USE_NETCDF
+    // The parts of the planes needed on this rank follow the new grids
+    for (amrex::OrientationIter oit; oit != nullptr; ++oit) {
+        auto ori = oit();
+        if (!m_in_data.is_populated(ori)) {
+            continue;
+        }
+        for (int lev = 0; lev < m_in_data.nlevels(ori); ++lev) {
+            m_in_data.redefine_level_data(
+                ori, lev, local_plane_box(lev, m_in_data.plane_box(ori, lev)));
+        }
+    }
+    read_window();
+#endif
+}
+
 void ABLBoundaryPlane::initialize_data()
 {
     BL_PROFILE("amr-wind::ABLBoundaryPlane::initialize_data");
@@ -470,11 +633,12 @@ void ABLBoundaryPlane::write_header()
                     if (fld->num_comp() == 1) {
                         lev_grp.def_var(
                             name, NC_DOUBLE,
-                            {"nt", dirs[perp[0]], dirs[perp[1]]});
+                            {"nt", dirs[perp[0]], dirs[perp[1]]}, m_nc_opts);
                     } else if (fld->num_comp() == AMREX_SPACEDIM) {
                         lev_grp.def_var(
                             name, NC_DOUBLE,
-                            {"nt", dirs[perp[0]], dirs[perp[1]], "vdim"});
+                            {"nt", dirs[perp[0]], dirs[perp[1]], "vdim"},
+                            m_nc_opts);
                     }
                 }
             }
@@ -749,9 +913,11 @@ void ABLBoundaryPlane::read_header()
     if (m_out_fmt == "netcdf") {
         amrex::Print() << "Reading input NetCDF file: " << m_filename
                        << std::endl;
-        auto ncf = ncutils::NCFile::open_par(
+        // The file stays open while the planes are read
+        m_in_file = std::make_unique<ncutils::NCFile>(ncutils::NCFile::open_par(
             m_filename, NC_NOWRITE | NC_NETCDF4 | NC_MPIIO,
-            amrex::ParallelContext::CommunicatorSub(), MPI_INFO_NULL);
+            amrex::ParallelContext::CommunicatorSub(), MPI_INFO_NULL));
+        auto& ncf = *m_in_file;
 
         // Store the input file times and reset to start at 0
         const size_t nt = ncf.dim("nt").len();
@@ -821,7 +987,9 @@ void ABLBoundaryPlane::read_header()
                         static_cast<int>(nc);
                     nc += fld->num_comp();
                 }
-                m_in_data.define_level_data(ori, pbx, nc);
+                const amrex::Box lbx =
+                    m_local_reads ? local_plane_box(lev, pbx) : pbx;
+                m_in_data.define_level_data(ori, pbx, lbx, nc);
             }
         }
 
@@ -950,6 +1118,39 @@ void ABLBoundaryPlane::read_header()
     }
 }
 
+amrex::Box
+ABLBoundaryPlane::local_plane_box(const int lev, const amrex::Box& pbx) const
+{
+    // The boundary is filled on the grids of this level and on the coarsened
+    // grids of the next finer level
+    amrex::Box lbx;
+    const int max_lev = amrex::min(lev + 1, m_mesh.finestLevel());
+    for (int ilev = lev; ilev <= max_lev; ++ilev) {
+        const amrex::IntVect rr =
+            (ilev > lev) ? m_mesh.refRatio(lev) : amrex::IntVect(1);
+        add_local_grids(
+            m_mesh.boxArray(ilev), m_mesh.DistributionMap(ilev), rr,
+            local_plane_ngrow(), pbx, lbx);
+    }
+    // Keep a single cell on ranks without boundary grids so that every rank
+    // takes part in the collective reads
+    if (lbx.isEmpty()) {
+        lbx = amrex::Box(pbx.smallEnd(), pbx.smallEnd());
+    }
+    return lbx;
+}
+
+int ABLBoundaryPlane::local_plane_ngrow() const
+{
+    // Ghost cells of the fields and stencil of the interpolation between
+    // levels
+    int ngrow = 1;
+    for (const auto* fld : m_fields) {
+        ngrow = amrex::max(ngrow, fld->num_grow().max() + 1);
+    }
+    return ngrow;
+}
+
 amrex::Vector<amrex::BoxArray> ABLBoundaryPlane::read_bndry_native_boxarrays(
     const std::string& chkname, const Field& field) const
 {
@@ -1189,25 +1390,43 @@ void ABLBoundaryPlane::read_file(const bool nph_target_time)
         return;
     }
 
+    const bool read_n = m_in_data.advance_window(time, m_in_times);
+
 #ifdef AMR_WIND_USE_NETCDF
     if (m_out_fmt == "netcdf") {
 
-        auto ncf = ncutils::NCFile::open_par(
-            m_filename, NC_NOWRITE | NC_NETCDF4 | NC_MPIIO,
-            amrex::ParallelContext::CommunicatorSub(), MPI_INFO_NULL);
-
-        for (amrex::OrientationIter oit; oit != nullptr; ++oit) {
-            auto ori = oit();
-            if (!m_in_data.is_populated(ori)) {
-                continue;
+        const int idx = m_in_data.index_n();
+        if (m_prefetch) {
+            // The next records are read together once the window leaves
+            // the ones read so far
+            const int first = read_n ? idx : idx + 1;
+            if (!m_in_data.is_prefetched(first) ||
+                !m_in_data.is_prefetched(idx + 1)) {
+                prefetch_planes(first);
+            }
+            if (read_n) {
+                m_in_data.use_prefetch(idx, false);
             }
+            m_in_data.use_prefetch(idx + 1, true);
+        } else {
+            auto& ncf = *m_in_file;
+            for (amrex::OrientationIter oit; oit != nullptr; ++oit) {
+                auto ori = oit();
+                if (!m_in_data.is_populated(ori)) {
+                    continue;
+                }
 
-            const std::string plane = m_plane_names[ori];
-            const int nlevels = ncf.group(plane).num_groups();
-            for (auto* fld : m_fields) {
-                for (int lev = 0; lev < nlevels; ++lev) {
-                    auto grp = ncf.group(plane).group(level_name(lev));
-                    m_in_data.read_data(grp, ori, lev, fld, time, m_in_times);
+                const std::string plane = m_plane_names[ori];
+                const int nlevels = ncf.group(plane).num_groups();
+                for (auto* fld : m_fields) {
+                    for (int lev = 0; lev < nlevels; ++lev) {
+                        auto grp = ncf.group(plane).group(level_name(lev));
+                        grp.var(fld->name()).par_access(NC_COLLECTIVE);
+                        if (read_n) {
+                            m_in_data.read_data(grp, ori, lev, fld, false);
+                        }
+                        m_in_data.read_data(grp, ori, lev, fld, true);
+                    }
                 }
             }
         }
@@ -1217,32 +1436,10 @@ void ABLBoundaryPlane::read_file(const bool nph_target_time)
 
     if (m_out_fmt == "native") {
 
-        const int index =
-            utils::closest_index(m_in_times, time, constants::LOOSE_TOL);
+        const int index = m_in_data.index_n();
         const int t_step1 = m_in_timesteps[index];
         const int t_step2 = m_in_timesteps[index + 1];
 
-        if (!(m_in_times[index] <= time + constants::LOOSE_TOL) ||
-            !(time <= m_in_times[index + 1] + constants::LOOSE_TOL)) {
-            amrex::Abort(
-                "ABLBoundaryPlane.cpp ABLBoundaryPlane::read_file() check 2"
-                "failed\n"
-                "Left time quantities should be <= right time quantities. "
-                "Indices supplied for debugging.\n"
-                "m_in_times[index] = " +
-                std::to_string(m_in_times[index]) + ", time + LOOSE_TOL = " +
-                std::to_string(time + constants::LOOSE_TOL) +
-                "\n"
-                "time = " +
-                std::to_string(time) +
-                ", m_in_times[index + 1] + LOOSE_TOL = " +
-                std::to_string(m_in_times[index + 1] + constants::LOOSE_TOL) +
-                "\n"
-                "index = " +
-                std::to_string(index) +
-                ", index + 1 = " + std::to_string(index + 1));
-        }
-
         const std::string chkname1 =
             m_filename + amrex::Concatenate("/bndry_output", t_step1);
         const std::string chkname2 =
@@ -1260,19 +1457,13 @@ void ABLBoundaryPlane::read_file(const bool nph_target_time)
                 const auto& ba = bndry_bas[lev];
                 amrex::DistributionMapping dm{ba};
 
-                amrex::BndryRegister bndry1(
-                    ba, dm, m_in_rad, m_out_rad, m_extent_rad,
-                    field.num_comp());
-                amrex::BndryRegister bndry2(
+                amrex::BndryRegister bndry(
                     ba, dm, m_in_rad, m_out_rad, m_extent_rad,
                     field.num_comp());
 
-                bndry1.setVal(1.0e13);
-                bndry2.setVal(1.0e13);
-
-                std::string filename1 = amrex::MultiFabFileFullPrefix(
+                const std::string filename1 = amrex::MultiFabFileFullPrefix(
                     lev, chkname1, level_prefix, field.name());
-                std::string filename2 = amrex::MultiFabFileFullPrefix(
+                const std::string filename2 = amrex::MultiFabFileFullPrefix(
                     lev, chkname2, level_prefix, field.name());
 
                 for (amrex::OrientationIter oit; oit != nullptr; ++oit) {
@@ -1284,16 +1475,18 @@ void ABLBoundaryPlane::read_file(const bool nph_target_time)
                         continue;
                     }
 
-                    std::string facename1 =
-                        amrex::Concatenate(filename1 + '_', ori, 1);
-                    std::string facename2 =
-                        amrex::Concatenate(filename2 + '_', ori, 1);
-
-                    bndry1[ori].read(facename1);
-                    bndry2[ori].read(facename2);
+                    if (read_n) {
+                        bndry[ori].setVal(1.0e13);
+                        bndry[ori].read(
+                            amrex::Concatenate(filename1 + '_', ori, 1));
+                        m_in_data.read_data_native(
+                            oit, bndry, lev, fld, false);
+                    }
 
-                    m_in_data.read_data_native(
-                        oit, bndry1, bndry2, lev, fld, time, m_in_times);
+                    bndry[ori].setVal(1.0e13);
+                    bndry[ori].read(
+                        amrex::Concatenate(filename2 + '_', ori, 1));
+                    m_in_data.read_data_native(oit, bndry, lev, fld, true);
                 }
             }
         }
@@ -1302,14 +1495,91 @@ void ABLBoundaryPlane::read_file(const bool nph_target_time)
     m_in_data.interpolate(time);
 }
 
-// NOLINTNEXTLINE(readability-convert-member-functions-to-static)
+#ifdef AMR_WIND_USE_NETCDF
+void ABLBoundaryPlane::prefetch_planes(const int idx)
+{
+    BL_PROFILE("amr-wind::ABLBoundaryPlane::prefetch_planes");
+    const int nrec = amrex::min(
+        m_prefetch_records, static_cast<int>(m_in_times.size()) - idx);
+    m_in_data.start_prefetch(idx, nrec);
+
+    auto& ncf = *m_in_file;
+    for (amrex::OrientationIter oit; oit != nullptr; ++oit) {
+        auto ori = oit();
+        if (!m_in_data.is_populated(ori)) {
+            continue;
+        }
+        for (auto* fld : m_fields) {
+            for (int lev = 0; lev < m_in_data.nlevels(ori); ++lev) {
+                auto grp =
+                    ncf.group(m_plane_names[ori]).group(level_name(lev));
+                grp.var(fld->name()).par_access(NC_COLLECTIVE);
+                m_in_data.prefetch(grp, ori, lev, fld);
+            }
+        }
+    }
+}
+
+void ABLBoundaryPlane::read_window()
+{
+    BL_PROFILE("amr-wind::ABLBoundaryPlane::read_window");
+    if (m_in_data.index_n() < 0) {
+        return;
+    }
+
+    auto& ncf = *m_in_file;
+    for (amrex::OrientationIter oit; oit != nullptr; ++oit) {
+        auto ori = oit();
+        if (!m_in_data.is_populated(ori)) {
+            continue;
+        }
+        for (auto* fld : m_fields) {
+            for (int lev = 0; lev < m_in_data.nlevels(ori); ++lev) {
+                auto grp =
+                    ncf.group(m_plane_names[ori]).group(level_name(lev));
+                grp.var(fld->name()).par_access(NC_COLLECTIVE);
+                m_in_data.read_data(grp, ori, lev, fld, false);
+                m_in_data.read_data(grp, ori, lev, fld, true);
+            }
+        }
+    }
+    m_in_data.interpolate(m_in_data.tinterp());
+}
+
+void ABLBoundaryPlane::extend_local_planes(
+    const int lev, const amrex::MultiFab& mfab)
+{
+    bool extended = false;
+    for (amrex::OrientationIter oit; oit != nullptr; ++oit) {
+        auto ori = oit();
+        if ((!m_in_data.is_populated(ori)) || (lev >= m_in_data.nlevels(ori))) {
+            continue;
+        }
+        const auto& pbx = m_in_data.plane_box(ori, lev);
+        amrex::Box lbx = m_in_data.interpolate_data(ori, lev).box();
+        add_local_grids(
+            mfab.boxArray(), mfab.DistributionMap(), amrex::IntVect(1),
+            local_plane_ngrow(), pbx, lbx);
+        if (lbx != m_in_data.interpolate_data(ori, lev).box()) {
+            m_in_data.redefine_level_data(ori, lev, lbx);
+            extended = true;
+        }
+    }
+
+    amrex::ParallelDescriptor::ReduceBoolOr(extended);
+    if (extended) {
+        read_window();
+    }
+}
+#endif
+
 void ABLBoundaryPlane::populate_data(
     const int lev,
     const amrex::Real time,
     Field& fld,
     amrex::MultiFab& mfab,
     const int dcomp,
-    const int orig_comp) const
+    const int orig_comp)
 {
 
     BL_PROFILE("amr-wind::ABLBoundaryPlane::populate_data");
@@ -1347,6 +1617,18 @@ void ABLBoundaryPlane::populate_data(
             ", m_in_data.tinterp() = " + std::to_string(m_in_data.tinterp()));
     }
 
+#ifdef AMR_WIND_USE_NETCDF
+    // While the mesh is regridded, the boundary is filled on the new grids
+    // before post_regrid_actions, so the parts of the planes stored on this
+    // rank are extended to cover them
+    if (m_local_reads &&
+        ((lev > m_mesh.finestLevel()) ||
+         !mfab.boxArray().CellEqual(m_mesh.boxArray(lev)) ||
+         (mfab.DistributionMap() != m_mesh.DistributionMap(lev)))) {
+        extend_local_planes(lev, mfab);
+    }
+#endif
+
     for (amrex::OrientationIter oit; oit != nullptr; ++oit) {
         auto ori = oit();
         if ((!m_in_data.is_populated(ori)) ||
@@ -1429,115 +1711,114 @@ void ABLBoundaryPlane::write_data(
 
     grp.var(name).par_access(NC_COLLECTIVE);
 
-    // TODO optimization
-    // - move buffer outside this function, probably best as a member
-    // - place in object to access as ori/lev/fld
-    // - sizing and start/counts should be done only on init and regrid
-    const auto n_buffers = m_mesh.boxArray(lev).size();
-    amrex::Vector<BufferData> buffers(n_buffers);
+    // Boundary faces of the boxes on this rank
+    amrex::Vector<amrex::Box> faces;
+    amrex::Vector<int> face_boxes;
+    for (amrex::MFIter mfi((*fld)(lev), false); mfi.isValid(); ++mfi) {
+        const auto& bx = mfi.validbox();
+        const bool at_lo = ori.isLow() && (bx.smallEnd(normal) == dlo[normal]);
+        const bool at_hi = ori.isHigh() && (bx.bigEnd(normal) == dhi[normal]);
+        if (!at_lo && !at_hi) {
+            continue;
+        }
+
+        // the high face is shifted by one to reuse impl_buffer_field
+        const int iface = at_lo ? dlo[normal] : dhi[normal] + 1;
+        amrex::Box face(bx);
+        face.setSmall(normal, iface);
+        face.setBig(normal, iface);
+        faces.push_back(face);
+        face_boxes.push_back(mfi.index());
+    }
 
     // Compute the minimal offset from the edge of the domain (in case
     // the refinement zones don't coincide with the low edge)
     amrex::IntVect min_lo(std::numeric_limits<int>::max());
     min_lo[normal] = 0;
-#ifdef AMREX_USE_OMP
-#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
-#endif
-    for (amrex::MFIter mfi((*fld)(lev), false); mfi.isValid(); ++mfi) {
-
-        const auto& bx = mfi.tilebox();
-        const auto& blo = bx.loVect();
-        const auto& bhi = bx.hiVect();
-
-        if ((blo[normal] == dlo[normal] && ori.isLow()) ||
-            (bhi[normal] == dhi[normal] && ori.isHigh())) {
-            min_lo[perp[0]] = std::min(min_lo[perp[0]], blo[perp[0]]);
-            min_lo[perp[1]] = std::min(min_lo[perp[1]], blo[perp[1]]);
-        }
+    for (const auto& face : faces) {
+        min_lo[perp[0]] = std::min(min_lo[perp[0]], face.smallEnd(perp[0]));
+        min_lo[perp[1]] = std::min(min_lo[perp[1]], face.smallEnd(perp[1]));
     }
     amrex::ParallelDescriptor::ReduceIntMin(min_lo.begin(), min_lo.size());
 
-#ifdef AMREX_USE_OMP
-#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
-#endif
-    for (amrex::MFIter mfi((*fld)(lev), false); mfi.isValid(); ++mfi) {
-
-        const auto& bx = mfi.tilebox();
-        const auto& blo = bx.loVect();
-        const auto& bhi = bx.hiVect();
-
-        if (blo[normal] == dlo[normal] && ori.isLow()) {
-            amrex::IntVect lo(blo);
-            amrex::IntVect hi(bhi);
-            lo[normal] = dlo[normal];
-            hi[normal] = dlo[normal];
-            const amrex::Box lbx(lo, hi);
-
-            const size_t n0 = hi[perp[0]] - lo[perp[0]] + 1;
-            const size_t n1 = hi[perp[1]] - lo[perp[1]] + 1;
-
-            auto& buffer = buffers[mfi.index()];
-            buffer.data.resize(n0 * n1 * nc);
-
-            auto const& fld_arr = (*fld)(lev).array(mfi);
-            impl_buffer_field(
-                lbx, static_cast<int>(n1), static_cast<int>(nc), perp, v_offset,
-                fld_arr, buffer.data);
-            amrex::Gpu::streamSynchronize();
-
-            buffer.start = {
-                m_out_counter,
-                static_cast<size_t>(lo[perp[0]] - min_lo[perp[0]]),
-                static_cast<size_t>(lo[perp[1]] - min_lo[perp[1]]), 0};
-            buffer.count = {1, n0, n1, nc};
-        } else if (bhi[normal] == dhi[normal] && ori.isHigh()) {
-            amrex::IntVect lo(blo);
-            amrex::IntVect hi(bhi);
-            // shift by one to reuse impl_buffer_field
-            lo[normal] = dhi[normal] + 1;
-            hi[normal] = dhi[normal] + 1;
-            const amrex::Box lbx(lo, hi);
-
-            const size_t n0 = hi[perp[0]] - lo[perp[0]] + 1;
-            const size_t n1 = hi[perp[1]] - lo[perp[1]] + 1;
-
-            auto& buffer = buffers[mfi.index()];
-            buffer.data.resize(n0 * n1 * nc);
-
-            auto const& fld_arr = (*fld)(lev).array(mfi);
-            impl_buffer_field(
-                lbx, static_cast<int>(n1), static_cast<int>(nc), perp, v_offset,
-                fld_arr, buffer.data);
-            amrex::Gpu::streamSynchronize();
-
-            buffer.start = {
-                m_out_counter,
-                static_cast<size_t>(lo[perp[0]] - min_lo[perp[0]]),
-                static_cast<size_t>(lo[perp[1]] - min_lo[perp[1]]), 0};
-            buffer.count = {1, n0, n1, nc};
+    // Regions written with one put each: the bounding box of the faces if
+    // they tile it, otherwise the individual faces
+    amrex::Vector<amrex::Box> regions;
+    amrex::Vector<int> face_regions(faces.size());
+    if (!faces.empty()) {
+        amrex::Box rbx(faces[0]);
+        amrex::Long npts = 0;
+        for (const auto& face : faces) {
+            rbx.minBox(face);
+            npts += face.numPts();
+        }
+        if (npts == rbx.numPts()) {
+            regions.push_back(rbx);
+            std::fill(face_regions.begin(), face_regions.end(), 0);
+        } else {
+            regions = faces;
+            std::iota(face_regions.begin(), face_regions.end(), 0);
         }
     }
 
-    for (const auto& buffer : buffers) {
-        grp.var(name).put(buffer.data.dataPtr(), buffer.start, buffer.count);
+    amrex::Vector<size_t> offsets(regions.size() + 1, 0);
+    for (int r = 0; r < static_cast<int>(regions.size()); ++r) {
+        offsets[r + 1] = offsets[r] + regions[r].numPts() * nc;
+    }
+    m_write_buffer.resize(offsets.back());
+    m_h_write_buffer.resize(offsets.back());
+
+    // Pack all the faces in a single buffer
+    for (int f = 0; f < static_cast<int>(faces.size()); ++f) {
+        const int r = face_regions[f];
+        const auto& rbx = regions[r];
+        impl_buffer_field(
+            faces[f], rbx.smallEnd(), rbx.length(perp[1]),
+            static_cast<int>(nc), perp, v_offset,
+            (*fld)(lev).const_array(face_boxes[f]),
+            m_write_buffer.data() + offsets[r]);
+    }
+    amrex::Gpu::copy(
+        amrex::Gpu::deviceToHost, m_write_buffer.begin(), m_write_buffer.end(),
+        m_h_write_buffer.begin());
+
+    // Every rank takes part in the same number of collective puts
+    int nputs = static_cast<int>(regions.size());
+    amrex::ParallelDescriptor::ReduceIntMax(nputs);
+    for (int r = 0; r < nputs; ++r) {
+        amrex::Vector<size_t> start{0, 0, 0, 0};
+        amrex::Vector<size_t> count{0, 0, 0, 0};
+        auto* data = m_h_write_buffer.data();
+        if (r < static_cast<int>(regions.size())) {
+            const auto& rbx = regions[r];
+            start = {
+                m_out_counter,
+                static_cast<size_t>(rbx.smallEnd(perp[0]) - min_lo[perp[0]]),
+                static_cast<size_t>(rbx.smallEnd(perp[1]) - min_lo[perp[1]]),
+                0};
+            count = {
+                1, static_cast<size_t>(rbx.length(perp[0])),
+                static_cast<size_t>(rbx.length(perp[1])), nc};
+            data += offsets[r];
+        }
+        grp.var(name).put(data, start, count);
     }
 }
 
 void ABLBoundaryPlane::impl_buffer_field(
     const amrex::Box& bx,
+    const amrex::IntVect& rlo,
     const int n1,
     const int nc,
     const amrex::GpuArray<int, 2>& perp,
     const amrex::IntVect& v_offset,
     const amrex::Array4<const amrex::Real>& fld,
-    amrex::Gpu::ManagedVector<amrex::Real>& buffer)
+    amrex::Real* d_buffer)
 {
-    auto* d_buffer = buffer.dataPtr();
-    const auto lo = bx.loVect3d();
     amrex::ParallelFor(
         bx, nc, [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
-            const int i0 = plane_idx(i, j, k, perp[0], lo[perp[0]]);
-            const int i1 = plane_idx(i, j, k, perp[1], lo[perp[1]]);
+            const int i0 = plane_idx(i, j, k, perp[0], rlo[perp[0]]);
+            const int i1 = plane_idx(i, j, k, perp[1], rlo[perp[1]]);
             d_buffer[((i0 * n1) + i1) * nc + n] =
                 0.5 * (fld(i, j, k, n) + fld(i - v_offset[0], j - v_offset[1],
                                              k - v_offset[2], n));
@@ -6,7 +6,7 @@ ABLFillInflow::ABLFillInflow(
     Field& field,
     const amrex::AmrCore& mesh,
     const SimTime& time,
-    const ABLBoundaryPlane& bndry_plane)
+    ABLBoundaryPlane& bndry_plane)
     : FieldFillPatchOps<FieldBCDirichlet>(
           field, mesh, time, FieldInterpolator::CellConsLinear)
     , m_bndry_plane(bndry_plane)
@@ -56,6 +56,9 @@ void ABLStats::initialize()
         AMREX_ASSERT((0 <= m_normal_dir) && (m_normal_dir < AMREX_SPACEDIM));
         pp.query("kappa", m_kappa);
         pp.query("stats_do_energy_budget", m_do_energy_budget);
+#ifdef AMR_WIND_USE_NETCDF
+        ioutils::query_netcdf_options(pp, "stats_", m_nc_opts);
+#endif
     }
 
     {
@@ -410,14 +413,14 @@ void ABLStats::prepare_netcdf_file()
     ncf.def_dim("ndim", AMREX_SPACEDIM);
 
     ncf.def_var("time", NC_DOUBLE, {nt_name});
-    ncf.def_var("Q", NC_DOUBLE, {nt_name});
-    ncf.def_var("Tsurf", NC_DOUBLE, {nt_name});
-    ncf.def_var("ustar", NC_DOUBLE, {nt_name});
-    ncf.def_var("wstar", NC_DOUBLE, {nt_name});
-    ncf.def_var("L", NC_DOUBLE, {nt_name});
-    ncf.def_var("zi", NC_DOUBLE, {nt_name});
-    ncf.def_var("abl_forcing_x", NC_DOUBLE, {nt_name});
-    ncf.def_var("abl_forcing_y", NC_DOUBLE, {nt_name});
+    ncf.def_var("Q", NC_DOUBLE, {nt_name}, m_nc_opts);
+    ncf.def_var("Tsurf", NC_DOUBLE, {nt_name}, m_nc_opts);
+    ncf.def_var("ustar", NC_DOUBLE, {nt_name}, m_nc_opts);
+    ncf.def_var("wstar", NC_DOUBLE, {nt_name}, m_nc_opts);
+    ncf.def_var("L", NC_DOUBLE, {nt_name}, m_nc_opts);
+    ncf.def_var("zi", NC_DOUBLE, {nt_name}, m_nc_opts);
+    ncf.def_var("abl_forcing_x", NC_DOUBLE, {nt_name}, m_nc_opts);
+    ncf.def_var("abl_forcing_y", NC_DOUBLE, {nt_name}, m_nc_opts);
 
     auto grp = ncf.def_group("mean_profiles");
     size_t n_levels = m_pa_vel.ncell_line();
@@ -425,39 +428,39 @@ void ABLStats::prepare_netcdf_file()
     grp.def_dim("nlevels", n_levels);
     const std::vector<std::string> two_dim{nt_name, nlevels_name};
     grp.def_var("h", NC_DOUBLE, {nlevels_name});
-    grp.def_var("u", NC_DOUBLE, two_dim);
-    grp.def_var("v", NC_DOUBLE, two_dim);
-    grp.def_var("w", NC_DOUBLE, two_dim);
-    grp.def_var("hvelmag", NC_DOUBLE, two_dim);
-    grp.def_var("theta", NC_DOUBLE, two_dim);
+    grp.def_var("u", NC_DOUBLE, two_dim, m_nc_opts);
+    grp.def_var("v", NC_DOUBLE, two_dim, m_nc_opts);
+    grp.def_var("w", NC_DOUBLE, two_dim, m_nc_opts);
+    grp.def_var("hvelmag", NC_DOUBLE, two_dim, m_nc_opts);
+    grp.def_var("theta", NC_DOUBLE, two_dim, m_nc_opts);
     amrex::ParmParse pp("ABL");
     if (pp.contains("mesoscale_forcing") || pp.contains("WRFforcing")) {
-        grp.def_var("abl_meso_forcing_mom_x", NC_DOUBLE, two_dim);
-        grp.def_var("abl_meso_forcing_mom_y", NC_DOUBLE, two_dim);
-        grp.def_var("abl_meso_forcing_theta", NC_DOUBLE, two_dim);
+        grp.def_var("abl_meso_forcing_mom_x", NC_DOUBLE, two_dim, m_nc_opts);
+        grp.def_var("abl_meso_forcing_mom_y", NC_DOUBLE, two_dim, m_nc_opts);
+        grp.def_var("abl_meso_forcing_theta", NC_DOUBLE, two_dim, m_nc_opts);
     }
-    grp.def_var("mueff", NC_DOUBLE, two_dim);
-    grp.def_var("theta'theta'_r", NC_DOUBLE, two_dim);
-    grp.def_var("u'theta'_r", NC_DOUBLE, two_dim);
-    grp.def_var("v'theta'_r", NC_DOUBLE, two_dim);
-    grp.def_var("w'theta'_r", NC_DOUBLE, two_dim);
-    grp.def_var("u'u'_r", NC_DOUBLE, two_dim);
-    grp.def_var("u'v'_r", NC_DOUBLE, two_dim);
-    grp.def_var("u'w'_r", NC_DOUBLE, two_dim);
-    grp.def_var("v'v'_r", NC_DOUBLE, two_dim);
-    grp.def_var("v'w'_r", NC_DOUBLE, two_dim);
-    grp.def_var("w'w'_r", NC_DOUBLE, two_dim);
-    grp.def_var("u'u'u'_r", NC_DOUBLE, two_dim);
-    grp.def_var("v'v'v'_r", NC_DOUBLE, two_dim);
-    grp.def_var("w'w'w'_r", NC_DOUBLE, two_dim);
-    grp.def_var("u'theta'_sfs", NC_DOUBLE, two_dim);
-    grp.def_var("v'theta'_sfs", NC_DOUBLE, two_dim);
-    grp.def_var("w'theta'_sfs", NC_DOUBLE, two_dim);
-    grp.def_var("u'v'_sfs", NC_DOUBLE, two_dim);
-    grp.def_var("u'w'_sfs", NC_DOUBLE, two_dim);
-    grp.def_var("v'w'_sfs", NC_DOUBLE, two_dim);
+    grp.def_var("mueff", NC_DOUBLE, two_dim, m_nc_opts);
+    grp.def_var("theta'theta'_r", NC_DOUBLE, two_dim, m_nc_opts);
+    grp.def_var("u'theta'_r", NC_DOUBLE, two_dim, m_nc_opts);
+    grp.def_var("v'theta'_r", NC_DOUBLE, two_dim, m_nc_opts);
+    grp.def_var("w'theta'_r", NC_DOUBLE, two_dim, m_nc_opts);
+    grp.def_var("u'u'_r", NC_DOUBLE, two_dim, m_nc_opts);
+    grp.def_var("u'v'_r", NC_DOUBLE, two_dim, m_nc_opts);
+    grp.def_var("u'w'_r", NC_DOUBLE, two_dim, m_nc_opts);
+    grp.def_var("v'v'_r", NC_DOUBLE, two_dim, m_nc_opts);
+    grp.def_var("v'w'_r", NC_DOUBLE, two_dim, m_nc_opts);
+    grp.def_var("w'w'_r", NC_DOUBLE, two_dim, m_nc_opts);
+    grp.def_var("u'u'u'_r", NC_DOUBLE, two_dim, m_nc_opts);
+    grp.def_var("v'v'v'_r", NC_DOUBLE, two_dim, m_nc_opts);
+    grp.def_var("w'w'w'_r", NC_DOUBLE, two_dim, m_nc_opts);
+    grp.def_var("u'theta'_sfs", NC_DOUBLE, two_dim, m_nc_opts);
+    grp.def_var("v'theta'_sfs", NC_DOUBLE, two_dim, m_nc_opts);
+    grp.def_var("w'theta'_sfs", NC_DOUBLE, two_dim, m_nc_opts);
+    grp.def_var("u'v'_sfs", NC_DOUBLE, two_dim, m_nc_opts);
+    grp.def_var("u'w'_sfs", NC_DOUBLE, two_dim, m_nc_opts);
+    grp.def_var("v'w'_sfs", NC_DOUBLE, two_dim, m_nc_opts);
     if (m_sim.repo().field_exists("tke")) {
-        grp.def_var("k_sgs", NC_DOUBLE, two_dim);
+        grp.def_var("k_sgs", NC_DOUBLE, two_dim, m_nc_opts);
     }
 
     // Energy budget
@@ -468,10 +471,10 @@ void ABLStats::prepare_netcdf_file()
                 "OneEqKsgs turbulence model not being used. Energy budget "
                 "currently only applies to this turbulence model.");
         }
-        grp.def_var("tke_buoy", NC_DOUBLE, two_dim);
-        grp.def_var("tke_shear", NC_DOUBLE, two_dim);
-        grp.def_var("tke_dissip", NC_DOUBLE, two_dim);
-        grp.def_var("tke_diff", NC_DOUBLE, two_dim);
+        grp.def_var("tke_buoy", NC_DOUBLE, two_dim, m_nc_opts);
+        grp.def_var("tke_shear", NC_DOUBLE, two_dim, m_nc_opts);
+        grp.def_var("tke_dissip", NC_DOUBLE, two_dim, m_nc_opts);
+        grp.def_var("tke_diff", NC_DOUBLE, two_dim, m_nc_opts);
     }
 
     ncf.exit_def_mode();
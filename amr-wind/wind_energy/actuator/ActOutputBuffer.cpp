@@ -0,0 +1,43 @@
+#include "amr-wind/wind_energy/actuator/ActOutputBuffer.H"
+#include "amr-wind/utilities/ncutils/nc_interface.H"
+
+#include "AMReX.H"
+
+namespace amr_wind::actuator::utils {
+
+void OutputRecords::write() const
+{
+#ifdef AMR_WIND_USE_NETCDF
+    if (num_records == 0) {
+        return;
+    }
+
+    auto ncf = ncutils::NCFile::open(ncfile, NC_WRITE);
+    // Index of next timestep
+    const size_t nt = ncf.dim("num_time_steps").len();
+    auto grp = ncf.group(group);
+    for (const auto& var : vars) {
+        std::vector<size_t> start(var.shape.size() + 1, 0);
+        std::vector<size_t> count{num_records};
+        start[0] = nt;
+        count.insert(count.end(), var.shape.begin(), var.shape.end());
+        grp.var(var.name).put(var.data.data(), start, count);
+    }
+#endif
+}
+
+OutputRecords ActOutputBuffer::release()
+{
+    AMREX_ASSERT(m_ivar == 0);
+    OutputRecords recs{m_recs.ncfile, m_recs.group, m_recs.num_records, {}};
+    recs.vars.reserve(m_recs.vars.size());
+    for (auto& var : m_recs.vars) {
+        recs.vars.push_back({var.name, var.shape, std::move(var.data)});
+        var.data.clear();
+        var.data.reserve(recs.vars.back().data.size());
+    }
+    m_recs.num_records = 0;
+    return recs;
+}
+
+} // namespace amr_wind::actuator::utils
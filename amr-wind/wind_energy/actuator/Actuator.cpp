@@ -3,6 +3,7 @@
 #include "amr-wind/wind_energy/actuator/ActuatorContainer.H"
 #include "amr-wind/CFDSim.H"
 #include "amr-wind/core/FieldRepo.H"
+#include "amr-wind/utilities/index_operations.H"
 #include "amr-wind/utilities/io_utils.H"
 #include "amr-wind/utilities/IOManager.H"
 
@@ -25,6 +26,10 @@ void Actuator::pre_init_actions()
 
     amrex::Vector<std::string> labels;
     pp.getarr("labels", labels);
+    pp.query("incremental_migration", m_incremental_migration);
+    pp.query("sparse_source", m_sparse_source);
+    pp.query("output_buffer_size", m_out_buffer_size);
+    AMREX_ALWAYS_ASSERT(m_out_buffer_size > 0);
     ioutils::assert_with_message(
         ioutils::all_distinct(labels),
         "Duplicates in " + identifier() + ".labels");
@@ -138,10 +143,48 @@ void Actuator::post_regrid_actions()
     for (auto& act : m_actuators) {
         act->determine_influenced_procs();
     }
+    report_root_costs();
+
+    // The sparse source term layout refers to the data of the old grids
+    m_src_ba.clear();
+    m_src_dm.clear();
+    m_exch_idx.clear();
+    m_exch_mf.clear();
 
     setup_container();
 }
 
+/** Report the imbalance of the work done by the root processes
+ *
+ *  The actuators that measure their cost on the root process (e.g., the time
+ *  spent in OpenFAST) are summed for each rank since the previous regrid. The
+ *  actuators are not reassigned to other ranks.
+ */
+void Actuator::report_root_costs() const
+{
+    amrex::Real local_cost = 0.0;
+    for (const auto& act : m_actuators) {
+        if (act->info().is_root_proc) {
+            local_cost += act->info().root_cost;
+        }
+    }
+
+    amrex::Real max_cost = local_cost;
+    amrex::Real total_cost = local_cost;
+    amrex::ParallelDescriptor::ReduceRealMax(max_cost);
+    amrex::ParallelDescriptor::ReduceRealSum(total_cost);
+    if (!(total_cost > 0.0)) {
+        return;
+    }
+
+    const amrex::Real mean_cost =
+        total_cost / amrex::ParallelDescriptor::NProcs();
+    amrex::Print() << "Actuator: root process time since last regrid: max = "
+                   << max_cost << " s, mean = " << mean_cost
+                   << " s, imbalance (max/mean) = " << max_cost / mean_cost
+                   << std::endl;
+}
+
 void Actuator::pre_advance_work()
 {
     BL_PROFILE("amr-wind::actuator::Actuator::pre_advance_work");
@@ -162,28 +205,44 @@ void Actuator::communicate_turbine_io()
     if (!m_sim.helics().is_activated()) {
         return;
     }
-    // send power and yaw from root actuator proc to io proc
-    const int ptag = 0;
-    const int ytag = 1;
-    const size_t size = 1;
-    for (auto& ac : m_actuators) {
-        if (ac->info().is_root_proc) {
-            amrex::ParallelDescriptor::Send(
-                &m_sim.helics().m_turbine_power_to_controller[ac->info().id],
-                size, amrex::ParallelDescriptor::IOProcessorNumber(), ptag);
-            amrex::ParallelDescriptor::Send(
-                &m_sim.helics()
-                     .m_turbine_wind_direction_to_controller[ac->info().id],
-                size, amrex::ParallelDescriptor::IOProcessorNumber(), ytag);
+    // Gather the telemetry from the root actuator procs on the io proc with a
+    // single collective. The root proc of every actuator is known on all
+    // ranks, so the layout of the gathered buffer is determined locally.
+    auto& telemetry = m_sim.helics().m_turbine_telemetry;
+    constexpr int nfields = TurbineTelemetry::num_fields;
+    const int nprocs = amrex::ParallelDescriptor::NProcs();
+    const int iproc = amrex::ParallelDescriptor::MyProc();
+    std::vector<int> recv_counts(nprocs, 0);
+    for (const auto& ac : m_actuators) {
+        recv_counts[ac->info().root_proc] += nfields;
+    }
+    std::vector<int> displs(nprocs, 0);
+    for (int ip = 1; ip < nprocs; ++ip) {
+        displs[ip] = displs[ip - 1] + recv_counts[ip - 1];
+    }
+
+    amrex::Vector<amrex::Real> send_buf(recv_counts[iproc]);
+    {
+        int offset = 0;
+        for (const auto& ac : m_actuators) {
+            if (ac->info().root_proc == iproc) {
+                telemetry[ac->info().id].pack(&send_buf[offset]);
+                offset += nfields;
+            }
         }
-        if (amrex::ParallelDescriptor::IOProcessor()) {
-            amrex::ParallelDescriptor::Recv(
-                &m_sim.helics().m_turbine_power_to_controller[ac->info().id],
-                size, ac->info().root_proc, ptag);
-            amrex::ParallelDescriptor::Recv(
-                &m_sim.helics()
-                     .m_turbine_wind_direction_to_controller[ac->info().id],
-                size, ac->info().root_proc, ytag);
+    }
+
+    const bool is_io = amrex::ParallelDescriptor::IOProcessor();
+    amrex::Vector<amrex::Real> recv_buf(is_io ? num_actuators() * nfields : 0);
+    amrex::ParallelDescriptor::Gatherv(
+        send_buf.data(), recv_counts[iproc], recv_buf.data(), recv_counts,
+        displs, amrex::ParallelDescriptor::IOProcessorNumber());
+
+    if (is_io) {
+        for (const auto& ac : m_actuators) {
+            const int root = ac->info().root_proc;
+            telemetry[ac->info().id].unpack(&recv_buf[displs[root]]);
+            displs[root] += nfields;
         }
     }
 #endif
@@ -207,6 +266,7 @@ void Actuator::setup_container()
         }));
 
     m_container = std::make_unique<ActuatorContainer>(m_sim.mesh(), nlocal);
+    m_container->use_incremental_migration(m_incremental_migration);
 
     auto& pinfo = m_container->m_data;
     for (int i = 0, il = 0; i < ntotal; ++i) {
@@ -284,6 +344,11 @@ void Actuator::compute_forces()
 void Actuator::compute_source_term()
 {
     BL_PROFILE("amr-wind::actuator::Actuator::compute_source_term");
+    if (m_sparse_source) {
+        compute_sparse_source_term();
+        return;
+    }
+
     m_act_source.setVal(0.0);
     const int nlevels = m_sim.repo().num_active_levels();
 
@@ -308,6 +373,127 @@ void Actuator::compute_source_term()
     }
 }
 
+/** Compute the source terms only on boxes influenced by actuators
+ *
+ *  Boxes that intersect the bounding box of an actuator are flagged as source
+ *  boxes, and boxes whose ghost cells overlap a source box are flagged as
+ *  exchange boxes. Only boxes that are (or were at the previous timestep)
+ *  flagged are zeroed, only source boxes are visited by the actuator
+ *  instances, and the ghost cell exchange is restricted to the exchange boxes
+ *  through a MultiFab that aliases the data of those boxes. This MultiFab is
+ *  kept across timesteps and only rebuilt when the exchange boxes change or
+ *  after a regrid. All other boxes retain the zero values set when the flags
+ *  were first computed for the current grids.
+ */
+void Actuator::compute_sparse_source_term()
+{
+    BL_PROFILE("amr-wind::actuator::Actuator::compute_sparse_source_term");
+    const int nlevels = m_sim.repo().num_active_levels();
+    m_src_flags.resize(nlevels);
+    m_src_ba.resize(nlevels);
+    m_src_dm.resize(nlevels);
+    m_exch_idx.resize(nlevels);
+    m_exch_mf.resize(nlevels);
+
+    for (int lev = 0; lev < nlevels; ++lev) {
+        auto& sfab = m_act_source(lev);
+        const auto& geom = m_sim.mesh().Geom(lev);
+        const auto& ba = sfab.boxArray();
+        const auto& dm = sfab.DistributionMap();
+        const int nbx = static_cast<int>(ba.size());
+
+        // Grids changed, so reset the whole field
+        amrex::Vector<int> old_flags(nbx, 0);
+        if ((m_src_ba[lev] == ba) && (m_src_dm[lev] == dm)) {
+            old_flags = m_src_flags[lev];
+        } else {
+            sfab.setVal(0.0);
+            m_src_ba[lev] = ba;
+            m_src_dm[lev] = dm;
+            m_exch_idx[lev].clear();
+            m_exch_mf[lev].reset();
+        }
+
+        auto& flags = m_src_flags[lev];
+        flags.assign(nbx, 0);
+        for (const auto& ac : m_actuators) {
+            const auto abx =
+                ::amr_wind::utils::realbox_to_box(ac->info().bound_box, geom);
+            for (const auto& is : ba.intersections(abx)) {
+                flags[is.first] |= source_box;
+            }
+        }
+
+        const auto& pshifts = geom.periodicity().shiftIntVect();
+        const auto ngrow = sfab.nGrowVect();
+        for (int i = 0; i < nbx; ++i) {
+            if ((flags[i] & source_box) == 0) {
+                continue;
+            }
+            const auto gbx = amrex::grow(ba[i], ngrow);
+            for (const auto& iv : pshifts) {
+                for (const auto& is : ba.intersections(gbx + iv)) {
+                    flags[is.first] |= exchange_box;
+                }
+            }
+        }
+
+        amrex::Vector<int> exch_idx;
+        for (int i = 0; i < nbx; ++i) {
+            if ((flags[i] & exchange_box) != 0) {
+                exch_idx.push_back(i);
+            }
+        }
+        if (exch_idx != m_exch_idx[lev]) {
+            m_exch_idx[lev] = std::move(exch_idx);
+            m_exch_mf[lev].reset();
+            if (!m_exch_idx[lev].empty()) {
+                amrex::BoxList exch_bl;
+                amrex::Vector<int> exch_pmap;
+                for (const int i : m_exch_idx[lev]) {
+                    exch_bl.push_back(ba[i]);
+                    exch_pmap.push_back(dm[i]);
+                }
+                m_exch_mf[lev] = std::make_unique<amrex::MultiFab>(
+                    amrex::BoxArray(exch_bl),
+                    amrex::DistributionMapping(std::move(exch_pmap)),
+                    sfab.nComp(), ngrow, amrex::MFInfo().SetAlloc(false));
+                auto& exch_mf = *m_exch_mf[lev];
+                const auto& idx = m_exch_idx[lev];
+                for (amrex::MFIter mfi(exch_mf); mfi.isValid(); ++mfi) {
+                    exch_mf.setFab(
+                        mfi, amrex::FArrayBox(
+                                 sfab[idx[mfi.index()]], amrex::make_alias, 0,
+                                 sfab.nComp()));
+                }
+            }
+        }
+
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+        for (amrex::MFIter mfi(sfab); mfi.isValid(); ++mfi) {
+            const int idx = mfi.index();
+            if (((flags[idx] | old_flags[idx]) & exchange_box) != 0) {
+                sfab[mfi].setVal<amrex::RunOn::Device>(0.0);
+            }
+
+            if ((flags[idx] & source_box) != 0) {
+                for (auto& ac : m_actuators) {
+                    if (ac->info().actuator_in_proc) {
+                        ac->compute_source_term(lev, mfi, geom);
+                    }
+                }
+            }
+        }
+
+        // Ghost cell exchange amongst the boxes neighboring the source boxes
+        if (m_exch_mf[lev]) {
+            m_exch_mf[lev]->FillBoundary(geom.periodicity());
+        }
+    }
+}
+
 void Actuator::prepare_outputs()
 {
     BL_PROFILE("amr-wind::actuator::Actuator::prepare_outputs");
@@ -323,6 +509,7 @@ void Actuator::prepare_outputs()
     for (auto& ac : m_actuators) {
         if (ac->info().root_proc == iproc) {
             ac->prepare_outputs(sname);
+            ac->output_buffer().set_capacity(m_out_buffer_size);
         }
     }
 }
@@ -331,10 +518,29 @@ void Actuator::post_advance_work()
 {
     BL_PROFILE("amr-wind::actuator::Actuator::post_advance_work");
 
+    // Buffered records are written out before checkpoints so that the output
+    // files are consistent with the restart state
+    const bool flush = m_sim.time().write_checkpoint();
     const int iproc = amrex::ParallelDescriptor::MyProc();
     for (auto& ac : m_actuators) {
         if (ac->info().root_proc == iproc) {
             ac->write_outputs();
+            auto& buf = ac->output_buffer();
+            if (!buf.empty() && (flush || buf.full())) {
+                buf.release().write();
+            }
+        }
+    }
+}
+
+void Actuator::flush_outputs()
+{
+    BL_PROFILE("amr-wind::actuator::Actuator::flush_outputs");
+
+    const int iproc = amrex::ParallelDescriptor::MyProc();
+    for (auto& ac : m_actuators) {
+        if ((ac->info().root_proc == iproc) && !ac->output_buffer().empty()) {
+            ac->output_buffer().release().write();
         }
     }
 }
@@ -122,10 +122,16 @@ void ActuatorContainer::initialize_particles(const int total_pts)
     // are safe to use
     m_container_initialized = true;
     m_is_scattered = false;
+    m_is_distributed = false;
 }
 
 void ActuatorContainer::reset_container()
 {
+    // Particles are kept in place across timesteps in incremental mode
+    if (m_incremental && m_is_distributed) {
+        return;
+    }
+
     const int nlevels = m_mesh.finestLevel() + 1;
     for (int lev = 0; lev < nlevels; ++lev) {
         for (ParIterType pti(*this, lev); pti.isValid(); ++pti) {
@@ -162,31 +168,309 @@ void ActuatorContainer::update_positions()
     BL_PROFILE("amr-wind::actuator::ActuatorContainer::update_positions");
     AMREX_ALWAYS_ASSERT(m_container_initialized && !m_is_scattered);
 
-    const auto dpos = gpu::device_view(m_data.position);
-    const auto* const dptr = dpos.data();
+    if (m_incremental && m_is_distributed) {
+        // Particles only need to move to the neighboring boxes if they have
+        // not travelled far since the previous timestep
+        amrex::Real max_disp = update_particle_positions();
+        amrex::ParallelDescriptor::ReduceRealMax(max_disp);
+        if (max_disp < static_cast<amrex::Real>(max_local_cells)) {
+            Redistribute(0, -1, 0, max_local_cells);
+        } else {
+            Redistribute();
+        }
+    } else {
+        const auto dpos = gpu::device_view(m_data.position);
+        const auto* const dptr = dpos.data();
+        const int nlevels = m_mesh.finestLevel() + 1;
+        for (int lev = 0; lev < nlevels; ++lev) {
+            for (ParIterType pti(*this, lev); pti.isValid(); ++pti) {
+                const int np = pti.numParticles();
+                auto* pstruct = pti.GetArrayOfStructs()().data();
+
+                amrex::ParallelFor(
+                    np, [=] AMREX_GPU_DEVICE(const int ip) noexcept {
+                        auto& pp = pstruct[ip];
+                        const auto idx = pp.idata(0);
+
+                        const auto& pvec = dptr[idx];
+                        for (int n = 0; n < AMREX_SPACEDIM; ++n) {
+                            pp.pos(n) = pvec[n];
+                        }
+                    });
+            }
+        }
+
+        // Scatter particles to appropriate MPI ranks
+        Redistribute();
+        m_is_distributed = true;
+    }
+
+    // Indicate that it is safe to sample velocities
+    m_is_scattered = true;
+}
+
+/** Helper method for ActuatorContainer::update_positions
+ *
+ *  Updates the position vectors of particles that have been retained in the
+ *  boxes from the previous timestep. Each MPI rank only receives the position
+ *  vectors of the particles it holds from the MPI ranks where they were
+ *  created. The exchange pattern is rebuilt when the particles have moved to
+ *  different MPI ranks.
+ *
+ *  \return Maximum displacement of the particles on this rank in units of the
+ *  finest level cell size
+ */
+amrex::Real ActuatorContainer::update_particle_positions()
+{
+    BL_PROFILE(
+        "amr-wind::actuator::ActuatorContainer::update_particle_positions");
+    int changed = static_cast<int>(gather_held_points());
+    amrex::ParallelDescriptor::ReduceIntMax(changed);
+    if (changed != 0) {
+        build_position_exchange();
+    }
+
+    const int ncomp = AMREX_SPACEDIM;
+    const int nheld = static_cast<int>(m_held_ids.size());
+    amrex::Vector<amrex::Real> buff_host(
+        static_cast<size_t>(nheld) * ncomp, 0.0);
+    exchange_positions(buff_host);
+    amrex::Gpu::DeviceVector<amrex::Real> buff_device(buff_host.size());
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, buff_host.begin(), buff_host.end(),
+        buff_device.begin());
+
+    const auto* buffer_pointer = buff_device.data();
+    const auto* held_ids = m_held_ids_device.data();
+    const auto* offsets = m_proc_offsets_device.data();
+    const auto dxi = m_mesh.Geom(m_mesh.finestLevel()).InvCellSizeArray();
+
+    amrex::Real max_disp = 0.0;
     const int nlevels = m_mesh.finestLevel() + 1;
     for (int lev = 0; lev < nlevels; ++lev) {
         for (ParIterType pti(*this, lev); pti.isValid(); ++pti) {
             const int np = pti.numParticles();
             auto* pstruct = pti.GetArrayOfStructs()().data();
 
-            amrex::ParallelFor(np, [=] AMREX_GPU_DEVICE(const int ip) noexcept {
-                auto& pp = pstruct[ip];
-                const auto idx = pp.idata(0);
+            const amrex::Real tile_disp = amrex::Reduce::Max<amrex::Real>(
+                np,
+                [=] AMREX_GPU_DEVICE(const int ip) noexcept -> amrex::Real {
+                    auto& pp = pstruct[ip];
+                    const int gid = offsets[pp.cpu()] + pp.idata(0);
+
+                    // Position of this point in the sorted held indices
+                    int lo = 0;
+                    int hi = nheld - 1;
+                    while (lo < hi) {
+                        const int mid = (lo + hi) / 2;
+                        if (held_ids[mid] < gid) {
+                            lo = mid + 1;
+                        } else {
+                            hi = mid;
+                        }
+                    }
+
+                    amrex::Real disp = 0.0;
+                    for (int n = 0; n < AMREX_SPACEDIM; ++n) {
+                        const amrex::Real pnew = buffer_pointer[lo * ncomp + n];
+                        disp = amrex::max(
+                            disp, std::abs(pnew - pp.pos(n)) * dxi[n]);
+                        pp.pos(n) = pnew;
+                    }
+                    return disp;
+                },
+                0.0);
+            max_disp = amrex::max(max_disp, tile_disp);
+        }
+    }
+    return max_disp;
+}
 
-                const auto& pvec = dptr[idx];
-                for (int n = 0; n < AMREX_SPACEDIM; ++n) {
-                    pp.pos(n) = pvec[n];
-                }
+/** Helper method for ActuatorContainer::update_particle_positions
+ *
+ *  Collects the global indices of the points whose particles are held on this
+ *  MPI rank.
+ *
+ *  \return True if the held points have changed since the last call
+ */
+bool ActuatorContainer::gather_held_points()
+{
+    amrex::Vector<int> held_ids;
+    const auto* offsets = m_proc_offsets_device.data();
+    const int nlevels = m_mesh.finestLevel() + 1;
+    for (int lev = 0; lev < nlevels; ++lev) {
+        for (ParIterType pti(*this, lev); pti.isValid(); ++pti) {
+            const int np = pti.numParticles();
+            const auto* pstruct = pti.GetArrayOfStructs()().data();
+
+            amrex::Gpu::DeviceVector<int> ids(np);
+            auto* ids_ptr = ids.data();
+            amrex::ParallelFor(np, [=] AMREX_GPU_DEVICE(const int ip) noexcept {
+                const auto& pp = pstruct[ip];
+                ids_ptr[ip] = offsets[pp.cpu()] + pp.idata(0);
             });
+
+            const auto nstart = held_ids.size();
+            held_ids.resize(nstart + np);
+            amrex::Gpu::copy(
+                amrex::Gpu::deviceToHost, ids.begin(), ids.end(),
+                held_ids.begin() + nstart);
         }
     }
+    std::sort(held_ids.begin(), held_ids.end());
 
-    // Scatter particles to appropriate MPI ranks
-    Redistribute();
+    if (held_ids == m_held_ids) {
+        return false;
+    }
 
-    // Indicate that it is safe to sample velocities
-    m_is_scattered = true;
+    m_held_ids = std::move(held_ids);
+    m_held_ids_device.resize(m_held_ids.size());
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, m_held_ids.begin(), m_held_ids.end(),
+        m_held_ids_device.begin());
+    return true;
+}
+
+/** Helper method for ActuatorContainer::update_particle_positions
+ *
+ *  Sends the indices of the held points to the MPI ranks where they were
+ *  created, so that each MPI rank knows which of its position vectors are
+ *  needed by every other MPI rank.
+ */
+void ActuatorContainer::build_position_exchange()
+{
+    BL_PROFILE(
+        "amr-wind::actuator::ActuatorContainer::build_position_exchange");
+    const int nprocs = amrex::ParallelDescriptor::NProcs();
+    const int iproc = amrex::ParallelDescriptor::MyProc();
+
+    // The held indices are sorted, so they are grouped by originating rank
+    m_recv_counts.assign(nprocs, 0);
+    for (const int gid : m_held_ids) {
+        const auto it = std::upper_bound(
+            m_proc_offsets.begin(), m_proc_offsets.end(), gid);
+        ++m_recv_counts[static_cast<int>(it - m_proc_offsets.begin()) - 1];
+    }
+
+    amrex::Vector<int> send_counts(nprocs, 0);
+#ifdef AMREX_USE_MPI
+    MPI_Alltoall(
+        m_recv_counts.data(), 1, MPI_INT, send_counts.data(), 1, MPI_INT,
+        amrex::ParallelDescriptor::Communicator());
+#else
+    send_counts = m_recv_counts;
+#endif
+
+    m_send_ids.assign(nprocs, amrex::Vector<int>());
+    for (int ip = 0; ip < nprocs; ++ip) {
+        m_send_ids[ip].resize(send_counts[ip]);
+    }
+
+#ifdef AMREX_USE_MPI
+    const int tag = amrex::ParallelDescriptor::SeqNum();
+    amrex::Vector<MPI_Request> requests;
+#endif
+    int ioff = 0;
+    for (int ip = 0; ip < nprocs; ++ip) {
+        const int count = m_recv_counts[ip];
+        if (ip == iproc) {
+            std::copy(
+                m_held_ids.begin() + ioff, m_held_ids.begin() + ioff + count,
+                m_send_ids[ip].begin());
+            ioff += count;
+            continue;
+        }
+#ifdef AMREX_USE_MPI
+        if (count > 0) {
+            requests.emplace_back();
+            MPI_Isend(
+                m_held_ids.data() + ioff, count, MPI_INT, ip, tag,
+                amrex::ParallelDescriptor::Communicator(), &requests.back());
+        }
+        if (send_counts[ip] > 0) {
+            requests.emplace_back();
+            MPI_Irecv(
+                m_send_ids[ip].data(), send_counts[ip], MPI_INT, ip, tag,
+                amrex::ParallelDescriptor::Communicator(), &requests.back());
+        }
+#endif
+        ioff += count;
+    }
+#ifdef AMREX_USE_MPI
+    MPI_Waitall(
+        static_cast<int>(requests.size()), requests.data(),
+        MPI_STATUSES_IGNORE);
+#endif
+
+    // Convert to indices into the position vectors of this rank
+    for (auto& ids : m_send_ids) {
+        for (auto& id : ids) {
+            id -= m_proc_offsets[iproc];
+        }
+    }
+}
+
+/** Helper method for ActuatorContainer::update_particle_positions
+ *
+ *  Sends the position vectors of the points of this MPI rank to the MPI ranks
+ *  holding their particles, and receives the position vectors of the held
+ *  points in the order of the sorted held indices.
+ */
+void ActuatorContainer::exchange_positions(
+    amrex::Vector<amrex::Real>& buffer) const
+{
+    const int ncomp = AMREX_SPACEDIM;
+    const int nprocs = amrex::ParallelDescriptor::NProcs();
+    const int iproc = amrex::ParallelDescriptor::MyProc();
+    const auto& pos_arr = m_data.position;
+
+    const auto pack = [&](const amrex::Vector<int>& ids, amrex::Real* dst) {
+        for (int i = 0; i < static_cast<int>(ids.size()); ++i) {
+            for (int j = 0; j < ncomp; ++j) {
+                dst[i * ncomp + j] = pos_arr[ids[i]][j];
+            }
+        }
+    };
+
+#ifdef AMREX_USE_MPI
+    const int tag = amrex::ParallelDescriptor::SeqNum();
+    amrex::Vector<MPI_Request> requests;
+    amrex::Vector<amrex::Vector<amrex::Real>> send_buffers(nprocs);
+#endif
+    int ioff = 0;
+    for (int ip = 0; ip < nprocs; ++ip) {
+        const int count = m_recv_counts[ip];
+        if (ip == iproc) {
+            pack(m_send_ids[ip], buffer.data() + ioff * ncomp);
+            ioff += count;
+            continue;
+        }
+#ifdef AMREX_USE_MPI
+        if (count > 0) {
+            requests.emplace_back();
+            MPI_Irecv(
+                buffer.data() + ioff * ncomp, count * ncomp, MPI_DOUBLE, ip,
+                tag, amrex::ParallelDescriptor::Communicator(),
+                &requests.back());
+        }
+        const auto& ids = m_send_ids[ip];
+        if (!ids.empty()) {
+            send_buffers[ip].resize(ids.size() * ncomp);
+            pack(ids, send_buffers[ip].data());
+            requests.emplace_back();
+            MPI_Isend(
+                send_buffers[ip].data(), static_cast<int>(ids.size()) * ncomp,
+                MPI_DOUBLE, ip, tag, amrex::ParallelDescriptor::Communicator(),
+                &requests.back());
+        }
+#endif
+        ioff += count;
+    }
+#ifdef AMREX_USE_MPI
+    MPI_Waitall(
+        static_cast<int>(requests.size()), requests.data(),
+        MPI_STATUSES_IGNORE);
+#endif
 }
 
 /** Interpolate the velocity field using a trilinear interpolation
@@ -290,6 +574,7 @@ void ActuatorContainer::interpolate_fields(
 {
     BL_PROFILE("amr-wind::actuator::ActuatorContainer::interpolate_velocities");
     auto* dptr = m_pos_device.data();
+    const bool reset_pos = !m_incremental;
     const int nlevels = m_mesh.finestLevel() + 1;
     for (int lev = 0; lev < nlevels; ++lev) {
         const auto& geom = m_mesh.Geom(lev);
@@ -342,8 +627,11 @@ void ActuatorContainer::interpolate_fields(
                         wx_hi * wy_hi * wz_hi * varr(i + 1, j + 1, k + 1, ic);
 
                     // Reset position vectors so that the particles return back
-                    // to the MPI ranks with the turbines upon redistribution
-                    pp.pos(ic) = dptr[iproc][ic];
+                    // to the MPI ranks with the turbines upon redistribution.
+                    // In incremental mode, the particles remain in place.
+                    if (reset_pos) {
+                        pp.pos(ic) = dptr[iproc][ic];
+                    }
                 }
 
                 // density
@@ -0,0 +1,90 @@
+#include "amr-wind/wind_energy/actuator/PointBins.H"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+namespace amr_wind::actuator::utils {
+
+void PointBins::build(const VecList& pts, const amrex::Real width)
+{
+    BL_PROFILE("amr-wind::actuator::utils::PointBins::build");
+    AMREX_ALWAYS_ASSERT(width > 0.0);
+
+    const int npts = static_cast<int>(pts.size());
+    const amrex::Real big = std::numeric_limits<amrex::Real>::max();
+    m_bbox_lo = vs::Vector{big, big, big};
+    m_bbox_hi = vs::Vector{-big, -big, -big};
+    for (const auto& p : pts) {
+        for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+            m_bbox_lo[d] = amrex::min(m_bbox_lo[d], p[d]);
+            m_bbox_hi[d] = amrex::max(m_bbox_hi[d], p[d]);
+        }
+    }
+    if (npts < 1) {
+        m_bbox_lo = vs::Vector::zero();
+        m_bbox_hi = vs::Vector::zero();
+    }
+
+    // Determine bin layout, coarsening the bins if the points are spread over
+    // a region that is large compared to the cutoff radius. Wider bins only
+    // visit more points and never miss any within the cutoff.
+    amrex::Real bwidth = width;
+    amrex::GpuArray<int, AMREX_SPACEDIM> nbins{1, 1, 1};
+    while (true) {
+        amrex::Long ntotal = 1;
+        for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+            nbins[d] = amrex::max(
+                1, static_cast<int>(
+                       std::ceil((m_bbox_hi[d] - m_bbox_lo[d]) / bwidth)));
+            ntotal *= nbins[d];
+        }
+        if (ntotal <= max_bins) {
+            break;
+        }
+        bwidth *= 2.0;
+    }
+
+    m_view.lo = m_bbox_lo;
+    m_view.inv_width = 1.0 / bwidth;
+    m_view.nbins = nbins;
+    const int ntotal = nbins[0] * nbins[1] * nbins[2];
+
+    // Counting sort of the point indices by bin
+    amrex::Vector<int> bin_id(npts);
+    amrex::Vector<int> offsets(ntotal + 1, 0);
+    for (int ip = 0; ip < npts; ++ip) {
+        const auto& p = pts[ip];
+        const int i =
+            amrex::min(amrex::max(m_view.bin_coord(p.x(), 0), 0), nbins[0] - 1);
+        const int j =
+            amrex::min(amrex::max(m_view.bin_coord(p.y(), 1), 0), nbins[1] - 1);
+        const int k =
+            amrex::min(amrex::max(m_view.bin_coord(p.z(), 2), 0), nbins[2] - 1);
+        bin_id[ip] = m_view.flat_index(i, j, k);
+        ++offsets[bin_id[ip] + 1];
+    }
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+    amrex::Vector<int> ids(npts);
+    {
+        amrex::Vector<int> fill(offsets.begin(), offsets.end() - 1);
+        for (int ip = 0; ip < npts; ++ip) {
+            ids[fill[bin_id[ip]]++] = ip;
+        }
+    }
+
+    m_offsets.resize(offsets.size());
+    m_ids.resize(ids.size());
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, offsets.begin(), offsets.end(),
+        m_offsets.begin());
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, ids.begin(), ids.end(), m_ids.begin());
+    amrex::Gpu::streamSynchronize();
+
+    m_view.offsets = m_offsets.data();
+    m_view.ids = m_ids.data();
+}
+
+} // namespace amr_wind::actuator::utils
@@ -1,6 +1,8 @@
 #include "amr-wind/wind_energy/actuator/actuator_utils.H"
 #include "amr-wind/wind_energy/actuator/actuator_types.H"
 
+#include <limits>
+
 namespace amr_wind::actuator::utils {
 
 std::set<int> determine_influenced_procs(
@@ -31,60 +33,106 @@ std::set<int> determine_influenced_procs(
     return procs;
 }
 
-void determine_root_proc(ActInfo& info, amrex::Vector<int>& act_proc_count)
+namespace {
+
+//! Make a process the root of an actuator and update the flags of this rank
+void assign_root_proc(
+    ActInfo& info, amrex::Vector<int>& act_proc_count, const int root)
 {
-    auto& plist = info.procs;
-    bool assigned = false;
+    info.root_proc = root;
+    // Make sure the root process is part of the process list
+    info.procs.insert(root);
+    // Increment turbine count with the global tracking array
+    ++act_proc_count[root];
+
+    const int iproc = amrex::ParallelDescriptor::MyProc();
+    auto in_proc = info.procs.find(iproc);
+    info.actuator_in_proc = (in_proc != info.procs.end());
+    info.is_root_proc = (info.root_proc == iproc);
+
+    // By default we request all processes where turbine is active to have
+    // velocities sampled. Individual actuator instances can override this
+    info.sample_vel_in_proc = info.actuator_in_proc;
+}
+
+} // namespace
 
+void determine_root_proc(ActInfo& info, amrex::Vector<int>& act_proc_count)
+{
     // If any of the influenced procs is free (i.e., doesn't have a turbine
     // assigned to it) elect it as the root proc for this turbine and return
     // early.
-    for (auto ip : plist) {
+    for (auto ip : info.procs) {
         if (act_proc_count[ip] < 1) {
-            info.root_proc = ip;
-            ++act_proc_count[ip];
-            assigned = true;
-            break;
+            assign_root_proc(info, act_proc_count, ip);
+            return;
         }
     }
 
-    // If we found a root proc there is nothing more to do, so return early
-    if (assigned) {
-        const int iproc = amrex::ParallelDescriptor::MyProc();
-        auto in_proc = info.procs.find(iproc);
-        info.actuator_in_proc = (in_proc != info.procs.end());
-        info.is_root_proc = (info.root_proc == iproc);
-
-        // By default we request all processes where turbine is active to have
-        // velocities sampled. Individual actuator instances can override this
-        info.sample_vel_in_proc = info.actuator_in_proc;
-        return;
-    }
-
     // If we have reached here, then we have more turbines than processes
     // available. We will assign the current turbine to the process that is
     // managing the lowest number of turbines.
-
-    // Determine the MPI rank that contains the fewest turbines
     auto it = std::min_element(act_proc_count.begin(), act_proc_count.end());
-    // Make it the root process for this turbine
-    info.root_proc =
-        static_cast<int>(std::distance(act_proc_count.begin(), it));
-    // Make sure the root process is part of the process list
-    plist.insert(info.root_proc);
-    // Increment turbine count with the global tracking array
-    ++(*it);
+    assign_root_proc(
+        info, act_proc_count,
+        static_cast<int>(std::distance(act_proc_count.begin(), it)));
+}
 
-    {
-        const int iproc = amrex::ParallelDescriptor::MyProc();
-        auto in_proc = info.procs.find(iproc);
-        info.actuator_in_proc = (in_proc != info.procs.end());
-        info.is_root_proc = (info.root_proc == iproc);
+amrex::Vector<amrex::Real> rank_mesh_load(const amrex::AmrCore& mesh)
+{
+    const int nprocs = amrex::ParallelDescriptor::NProcs();
+    amrex::Vector<amrex::Real> load(nprocs, 0.0);
+
+    amrex::Real total = 0.0;
+    for (int lev = 0; lev <= mesh.finestLevel(); ++lev) {
+        const auto& ba = mesh.boxArray(lev);
+        const auto& dm = mesh.DistributionMap(lev);
+        for (int i = 0; i < static_cast<int>(ba.size()); ++i) {
+            const auto npts = static_cast<amrex::Real>(ba[i].numPts());
+            load[dm[i]] += npts;
+            total += npts;
+        }
+    }
+
+    if (total > 0.0) {
+        const amrex::Real fac = static_cast<amrex::Real>(nprocs) / total;
+        for (auto& val : load) {
+            val *= fac;
+        }
+    }
+    return load;
+}
+
+void determine_root_proc(
+    ActInfo& info,
+    amrex::Vector<int>& act_proc_count,
+    const amrex::Vector<amrex::Real>& mesh_load,
+    const amrex::Real cost)
+{
+    AMREX_ALWAYS_ASSERT(mesh_load.size() == act_proc_count.size());
+
+    // Prefer the least loaded influenced proc that is free
+    int root = -1;
+    for (auto ip : info.procs) {
+        if ((act_proc_count[ip] < 1) &&
+            ((root < 0) || (mesh_load[ip] < mesh_load[root]))) {
+            root = ip;
+        }
+    }
 
-        // By default we request all processes where turbine is active to have
-        // velocities sampled. Individual actuator instances can override this
-        info.sample_vel_in_proc = info.actuator_in_proc;
+    // Otherwise pick the rank with the lowest combined mesh and actuator cost
+    if (root < 0) {
+        amrex::Real min_cost = std::numeric_limits<amrex::Real>::max();
+        for (int ip = 0; ip < static_cast<int>(act_proc_count.size()); ++ip) {
+            const amrex::Real rcost = mesh_load[ip] + cost * act_proc_count[ip];
+            if (rcost < min_cost) {
+                min_cost = rcost;
+                root = ip;
+            }
+        }
     }
+
+    assign_root_proc(info, act_proc_count, root);
 }
 
 } // namespace amr_wind::actuator::utils
@@ -3,6 +3,7 @@
 
 #include <fstream>
 #include <algorithm>
+#include <cmath>
 
 namespace amr_wind::actuator {
 
@@ -12,11 +13,46 @@ AirfoilTable::AirfoilTable(const int num_entries)
 
 AirfoilTable::~AirfoilTable() = default;
 
+template <typename T>
+vs::Vector
+AirfoilTable::uniform_lookup(const T* table, const amrex::Real aoa) const
+{
+    const int nlast = m_num_uniform - 1;
+    const amrex::Real xi = (aoa - m_uniform_aoa0) * m_uniform_inv_daoa;
+    if (!(xi > 0.0)) {
+        return vs::Vector{table[0], table[1], table[2]};
+    }
+    if (xi >= static_cast<amrex::Real>(nlast)) {
+        const int j = 3 * nlast;
+        return vs::Vector{table[j], table[j + 1], table[j + 2]};
+    }
+
+    const int il = amrex::min(static_cast<int>(xi), nlast - 1);
+    const amrex::Real facR = xi - static_cast<amrex::Real>(il);
+    const amrex::Real facL = 1.0 - facR;
+    const int j = 3 * il;
+    return vs::Vector{
+        facL * table[j] + facR * table[j + 3],
+        facL * table[j + 1] + facR * table[j + 4],
+        facL * table[j + 2] + facR * table[j + 5]};
+}
+
+vs::Vector AirfoilTable::lookup(const amrex::Real aoa) const
+{
+    if (m_num_uniform > 0) {
+        return m_uniform_polar_sp.empty()
+                   ? uniform_lookup(m_uniform_polar.data(), aoa)
+                   : uniform_lookup(m_uniform_polar_sp.data(), aoa);
+    }
+
+    namespace interp = ::amr_wind::interp;
+    return interp::linear(m_aoa, m_polar, aoa);
+}
+
 void AirfoilTable::operator()(
     const amrex::Real aoa, amrex::Real& cl, amrex::Real& cd) const
 {
-    namespace interp = ::amr_wind::interp;
-    vs::Vector polar = interp::linear(m_aoa, m_polar, aoa);
+    vs::Vector polar = lookup(aoa);
     cl = polar.x();
     cd = polar.y();
 }
@@ -27,13 +63,107 @@ void AirfoilTable::operator()(
     amrex::Real& cd,
     amrex::Real& cm) const
 {
-    namespace interp = ::amr_wind::interp;
-    vs::Vector polar = interp::linear(m_aoa, m_polar, aoa);
+    vs::Vector polar = lookup(aoa);
     cl = polar.x();
     cd = polar.y();
     cm = polar.z();
 }
 
+void AirfoilTable::operator()(
+    const int npts,
+    const amrex::Real* aoa,
+    amrex::Real* cl,
+    amrex::Real* cd) const
+{
+    if (m_num_uniform > 0) {
+        if (m_uniform_polar_sp.empty()) {
+            const auto* table = m_uniform_polar.data();
+            for (int i = 0; i < npts; ++i) {
+                const auto polar = uniform_lookup(table, aoa[i]);
+                cl[i] = polar.x();
+                cd[i] = polar.y();
+            }
+        } else {
+            const auto* table = m_uniform_polar_sp.data();
+            for (int i = 0; i < npts; ++i) {
+                const auto polar = uniform_lookup(table, aoa[i]);
+                cl[i] = polar.x();
+                cd[i] = polar.y();
+            }
+        }
+        return;
+    }
+
+    namespace interp = ::amr_wind::interp;
+    for (int i = 0; i < npts; ++i) {
+        const auto polar = interp::linear(m_aoa, m_polar, aoa[i]);
+        cl[i] = polar.x();
+        cd[i] = polar.y();
+    }
+}
+
+amrex::Real
+AirfoilTable::resample_uniform(const amrex::Real daoa, const bool use_float)
+{
+    AMREX_ALWAYS_ASSERT(daoa > 0.0);
+    AMREX_ALWAYS_ASSERT(m_aoa.size() > 1);
+
+    // Disable any previous uniform table so that lookups use the original data
+    m_num_uniform = 0;
+    m_uniform_polar.clear();
+    m_uniform_polar_sp.clear();
+
+    const amrex::Real aoa_lo = m_aoa.front();
+    const amrex::Real aoa_hi = m_aoa.back();
+    const int nintervals = amrex::max(
+        1, static_cast<int>(std::ceil((aoa_hi - aoa_lo) / daoa - 1.0e-8)));
+    const amrex::Real dx = (aoa_hi - aoa_lo) / nintervals;
+    const int npts = nintervals + 1;
+
+    amrex::Vector<amrex::Real> polar(3 * static_cast<size_t>(npts));
+    {
+        namespace interp = ::amr_wind::interp;
+        for (int i = 0; i < npts; ++i) {
+            const amrex::Real aoa = (i < nintervals) ? aoa_lo + i * dx : aoa_hi;
+            const auto pp = interp::linear(m_aoa, m_polar, aoa);
+            for (int n = 0; n < 3; ++n) {
+                polar[3 * i + n] = pp[n];
+            }
+        }
+    }
+
+    // Compare against the original table before switching to the uniform table
+    RealList aoa_test;
+    VecList polar_ref;
+    for (int i = 0; i < num_entries(); ++i) {
+        aoa_test.push_back(m_aoa[i]);
+        if (i + 1 < num_entries()) {
+            aoa_test.push_back(0.5 * (m_aoa[i] + m_aoa[i + 1]));
+        }
+    }
+    for (const auto aoa : aoa_test) {
+        polar_ref.push_back(lookup(aoa));
+    }
+
+    m_uniform_aoa0 = aoa_lo;
+    m_uniform_inv_daoa = 1.0 / dx;
+    if (use_float) {
+        m_uniform_polar_sp.assign(polar.begin(), polar.end());
+    } else {
+        m_uniform_polar = std::move(polar);
+    }
+    m_num_uniform = npts;
+
+    amrex::Real max_err = 0.0;
+    for (int i = 0; i < static_cast<int>(aoa_test.size()); ++i) {
+        const auto pp = lookup(aoa_test[i]);
+        for (int n = 0; n < 3; ++n) {
+            max_err = amrex::max(max_err, std::abs(pp[n] - polar_ref[i][n]));
+        }
+    }
+    return max_err;
+}
+
 void ThinAirfoil::operator()(
     const amrex::Real aoa, amrex::Real& cl, amrex::Real& cd) const
 {
@@ -41,6 +171,17 @@ void ThinAirfoil::operator()(
     cd = m_cd_factor * std::sin(aoa);
 }
 
+void ThinAirfoil::operator()(
+    const int npts,
+    const amrex::Real* aoa,
+    amrex::Real* cl,
+    amrex::Real* cd) const
+{
+    for (int i = 0; i < npts; ++i) {
+        (*this)(aoa[i], cl[i], cd[i]);
+    }
+}
+
 void AirfoilTable::convert_aoa_to_radians()
 {
     std::transform(
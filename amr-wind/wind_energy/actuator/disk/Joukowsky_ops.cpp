@@ -154,7 +154,7 @@ void prepare_netcdf_file(
 }
 
 void write_netcdf(
-    const std::string& name,
+    utils::ActOutputBuffer& buf,
     const JoukowskyData& data,
     const ActInfo& info,
     const ActGrid& /*unused*/,
@@ -165,30 +165,23 @@ void write_netcdf(
     if (info.root_proc != amrex::ParallelDescriptor::MyProc()) {
         return;
     }
-    auto ncf = ncutils::NCFile::open(name, NC_WRITE);
-    const std::string nt_name = "num_time_steps";
-    // Index of next timestep
-    const size_t nt = ncf.dim(nt_name).len();
     const size_t nr = data.num_vel_pts_r;
     const size_t np = data.num_force_pts;
-    auto grp = ncf.group(info.label);
-    grp.var("time").put(&time, {nt}, {1});
-    grp.var("vref").put(
-        data.reference_velocity.data(), {nt, 0}, {1, AMREX_SPACEDIM});
-    grp.var("vdisk").put(
-        data.mean_disk_velocity.data(), {nt, 0}, {1, AMREX_SPACEDIM});
-    grp.var("tsr").put(&data.current_tip_speed_ratio, {nt}, {1});
-    grp.var("ct").put(&data.current_ct, {nt}, {1});
-    grp.var("cp").put(&data.current_cp, {nt}, {1});
-    grp.var("power").put(&data.current_power, {nt}, {1});
-    grp.var("density").put(&data.density, {nt}, {1});
-    grp.var("total_disk_force")
-        .put(data.disk_force.data(), {nt, 0}, {1, AMREX_SPACEDIM});
-    grp.var("angular_velocity").put(&data.current_angular_velocity, {nt}, {1});
-    grp.var("f_normal").put(data.f_normal.data(), {nt, 0}, {1, nr});
-    grp.var("f_theta").put(data.f_theta.data(), {nt, 0}, {1, np});
+    buf.put("time", &time);
+    buf.put("vref", data.reference_velocity.data(), {AMREX_SPACEDIM});
+    buf.put("vdisk", data.mean_disk_velocity.data(), {AMREX_SPACEDIM});
+    buf.put("tsr", &data.current_tip_speed_ratio);
+    buf.put("ct", &data.current_ct);
+    buf.put("cp", &data.current_cp);
+    buf.put("power", &data.current_power);
+    buf.put("density", &data.density);
+    buf.put("total_disk_force", data.disk_force.data(), {AMREX_SPACEDIM});
+    buf.put("angular_velocity", &data.current_angular_velocity);
+    buf.put("f_normal", data.f_normal.data(), {nr});
+    buf.put("f_theta", data.f_theta.data(), {np});
+    buf.end_record();
 #else
-    amrex::ignore_unused(name, data, info, time);
+    amrex::ignore_unused(buf, data, info, time);
 #endif
 }
 
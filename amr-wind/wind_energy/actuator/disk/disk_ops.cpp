@@ -68,7 +68,7 @@ void prepare_netcdf_file(
 }
 
 void write_netcdf(
-    const std::string& name,
+    utils::ActOutputBuffer& buf,
     const DiskBaseData& data,
     const ActInfo& info,
     const ActGrid& /*unused*/,
@@ -79,20 +79,14 @@ void write_netcdf(
     if (info.root_proc != amrex::ParallelDescriptor::MyProc()) {
         return;
     }
-    auto ncf = ncutils::NCFile::open(name, NC_WRITE);
-    const std::string nt_name = "num_time_steps";
-    // Index of next timestep
-    const size_t nt = ncf.dim(nt_name).len();
-    auto grp = ncf.group(info.label);
-    grp.var("time").put(&time, {nt}, {1});
-    grp.var("vref").put(
-        data.reference_velocity.data(), {nt, 0}, {1, AMREX_SPACEDIM});
-    grp.var("vdisk").put(
-        data.mean_disk_velocity.data(), {nt, 0}, {1, AMREX_SPACEDIM});
-    grp.var("ct").put(&data.current_ct, {nt}, {1});
-    grp.var("density").put(&data.density, {nt}, {1});
+    buf.put("time", &time);
+    buf.put("vref", data.reference_velocity.data(), {AMREX_SPACEDIM});
+    buf.put("vdisk", data.mean_disk_velocity.data(), {AMREX_SPACEDIM});
+    buf.put("ct", &data.current_ct);
+    buf.put("density", &data.density);
+    buf.end_record();
 #else
-    amrex::ignore_unused(name, data, info, time);
+    amrex::ignore_unused(buf, data, info, time);
 #endif
 }
 } // namespace disk
@@ -45,6 +45,8 @@ FastIface::FastIface(const amr_wind::CFDSim& /*unused*/) {}
 
 FastIface::~FastIface()
 {
+    wait_turbines();
+
     int ierr = ErrID_None;
     amrex::Array<char, fast_strlen()> err_msg;
     FAST_DeallocateTurbines(&ierr, err_msg.begin());
@@ -129,6 +131,7 @@ void FastIface::init_solution(const int local_id)
     AMREX_ALWAYS_ASSERT(local_id < static_cast<int>(m_turbine_data.size()));
     AMREX_ALWAYS_ASSERT(m_is_initialized);
 
+    wait_turbines();
     auto& fi = *m_turbine_data[local_id];
     fast_func(FAST_Solution0, &fi.tid_local);
     fi.is_solution0 = false;
@@ -150,26 +153,75 @@ void FastIface::advance_turbine(const int local_id)
     BL_PROFILE("amr-wind::FastIface::advance_turbine");
     AMREX_ASSERT(local_id < static_cast<int>(m_turbine_data.size()));
 
+    // Ensure that no asynchronous step is still active on this rank
+    wait_turbines();
+
     auto& fi = *m_turbine_data[local_id];
     AMREX_ASSERT(!fi.is_solution0);
-    {
-        const auto& tmax = fi.stop_time;
-        const auto& telapsed = (fi.time_index + fi.num_substeps) * fi.dt_fast;
-        if (telapsed > (tmax + 1.0e-8)) {
-            // clang-format off
-            amrex::OutStream()
-                << "\nWARNING: FastIface:\n"
-                << "  Elapsed simulation time will exceed max "
-                << "time set for OpenFAST"
-                << std::endl << std::endl;
-            // clang-format on
-        }
-    }
+    check_stop_time(fi);
 
     write_velocity_data(fi);
+    fast_step_turbine(fi);
+}
+
+void FastIface::advance_turbine_async(const int local_id)
+{
+    BL_PROFILE("amr-wind::FastIface::advance_turbine_async");
+    AMREX_ASSERT(local_id < static_cast<int>(m_turbine_data.size()));
+
+    auto& fi = *m_turbine_data[local_id];
+    AMREX_ASSERT(!fi.is_solution0);
+    check_stop_time(fi);
+
+    // NetCDF is not thread-safe, so velocity data is always written from the
+    // main thread before the step is launched.
+    write_velocity_data(fi);
+
+    // Chain this step after any step that is still running so that OpenFAST
+    // is never called concurrently from multiple threads.
+    m_pending_step = std::async(
+        std::launch::async,
+        [&fi, prev = std::move(m_pending_step)]() mutable {
+            if (prev.valid()) {
+                prev.get();
+            }
+            fast_step_turbine(fi);
+            fast_func(
+                FAST_HubPosition, &fi.tid_local, fi.hub_abs_pos.begin(),
+                fi.hub_rot_vel.begin(), fi.hub_orient.begin());
+        });
+}
+
+void FastIface::wait_turbines()
+{
+    if (m_pending_step.valid()) {
+        BL_PROFILE("amr-wind::FastIface::wait_turbines");
+        m_pending_step.get();
+    }
+}
+
+void FastIface::check_stop_time(const FastTurbine& fi)
+{
+    const auto& tmax = fi.stop_time;
+    const auto& telapsed = (fi.time_index + fi.num_substeps) * fi.dt_fast;
+    if (telapsed > (tmax + 1.0e-8)) {
+        // clang-format off
+        amrex::OutStream()
+            << "\nWARNING: FastIface:\n"
+            << "  Elapsed simulation time will exceed max "
+            << "time set for OpenFAST"
+            << std::endl << std::endl;
+        // clang-format on
+    }
+}
+
+void FastIface::fast_step_turbine(FastTurbine& fi)
+{
+    const double tstart = amrex::ParallelDescriptor::second();
     for (int i = 0; i < fi.num_substeps; ++i, ++fi.time_index) {
         fast_func(FAST_Step, &fi.tid_local);
     }
+    fi.step_time += amrex::ParallelDescriptor::second() - tstart;
 
     if (fi.chkpt_interval > 0 &&
         (fi.time_index / fi.num_substeps) % fi.chkpt_interval == 0) {
@@ -122,7 +122,7 @@ void prepare_netcdf_file(
 }
 
 void write_netcdf(
-    const std::string& ncfile,
+    utils::ActOutputBuffer& buf,
     const TurbineBaseData& meta,
     const TurbineInfo& info,
     const ActGrid& grid,
@@ -134,29 +134,20 @@ void write_netcdf(
         return;
     }
 
-    auto ncf = ncutils::NCFile::open(ncfile, NC_WRITE);
-    const std::string nt_name = "num_time_steps";
-    // Index of next timestep
-    const size_t nt = ncf.dim(nt_name).len();
     const size_t nfpts = grid.force.size();
     const size_t nvpts = grid.vel.size();
 
-    auto grp = ncf.group(info.label);
-    grp.var("time").put(&time, {nt}, {1});
-    grp.var("rot_center").put(meta.rot_center.data(), {nt, 0}, {1, 3});
-    grp.var("rotor_frame").put(meta.rotor_frame.data(), {nt, 0}, {1, 9});
-    grp.var("xyz").put(
-        grid.pos[0].data(), {nt, 0, 0}, {1, nfpts, AMREX_SPACEDIM});
-    grp.var("force").put(
-        grid.force[0].data(), {nt, 0, 0}, {1, nfpts, AMREX_SPACEDIM});
-    grp.var("orientation")
-        .put(grid.orientation[0].data(), {nt, 0, 0}, {1, nfpts, 9});
-    grp.var("vel_xyz").put(
-        grid.vel_pos[0].data(), {nt, 0, 0}, {1, nvpts, AMREX_SPACEDIM});
-    grp.var("vel").put(
-        grid.vel[0].data(), {nt, 0, 0}, {1, nvpts, AMREX_SPACEDIM});
+    buf.put("time", &time);
+    buf.put("rot_center", meta.rot_center.data(), {3});
+    buf.put("rotor_frame", meta.rotor_frame.data(), {9});
+    buf.put("xyz", grid.pos[0].data(), {nfpts, AMREX_SPACEDIM});
+    buf.put("force", grid.force[0].data(), {nfpts, AMREX_SPACEDIM});
+    buf.put("orientation", grid.orientation[0].data(), {nfpts, 9});
+    buf.put("vel_xyz", grid.vel_pos[0].data(), {nvpts, AMREX_SPACEDIM});
+    buf.put("vel", grid.vel[0].data(), {nvpts, AMREX_SPACEDIM});
+    buf.end_record();
 #else
-    amrex::ignore_unused(ncfile, meta, info, grid, time);
+    amrex::ignore_unused(buf, meta, info, grid, time);
 #endif
 }
 
@@ -109,7 +109,7 @@ void prepare_netcdf_file(
 }
 
 void write_netcdf(
-    const std::string& ncfile,
+    utils::ActOutputBuffer& buf,
     const WingBaseData& meta,
     const ActInfo& info,
     const ActGrid& grid,
@@ -121,30 +121,20 @@ void write_netcdf(
         return;
     }
 
-    auto ncf = ncutils::NCFile::open(ncfile, NC_WRITE);
-    const std::string nt_name = "num_time_steps";
-    // Index of next timestep
-    const size_t nt = ncf.dim(nt_name).len();
     const auto npts = static_cast<size_t>(meta.num_pts);
-
-    std::vector<size_t> start{nt, 0};
-    std::vector<size_t> count{1, npts};
-    auto grp = ncf.group(info.label);
-    grp.var("time").put(&time, {nt}, {1});
-    grp.var("pitch").put(&meta.pitch, {nt}, {1});
-    grp.var("integrated_lift").put(&meta.lift, {nt}, {1});
-    grp.var("integrated_drag").put(&meta.drag, {nt}, {1});
-    grp.var("vrel").put(
-        meta.vel_rel[0].data(), {nt, 0, 0}, {1, npts, AMREX_SPACEDIM});
-    grp.var("veff").put(
-        grid.vel[0].data(), {nt, 0, 0}, {1, npts, AMREX_SPACEDIM});
-    grp.var("body_force")
-        .put(grid.force[0].data(), {nt, 0, 0}, {1, npts, AMREX_SPACEDIM});
-    grp.var("aoa").put(meta.aoa.data(), start, count);
-    grp.var("cl").put(meta.cl.data(), start, count);
-    grp.var("cd").put(meta.cd.data(), start, count);
+    buf.put("time", &time);
+    buf.put("pitch", &meta.pitch);
+    buf.put("integrated_lift", &meta.lift);
+    buf.put("integrated_drag", &meta.drag);
+    buf.put("vrel", meta.vel_rel[0].data(), {npts, AMREX_SPACEDIM});
+    buf.put("veff", grid.vel[0].data(), {npts, AMREX_SPACEDIM});
+    buf.put("body_force", grid.force[0].data(), {npts, AMREX_SPACEDIM});
+    buf.put("aoa", meta.aoa.data(), {npts});
+    buf.put("cl", meta.cl.data(), {npts});
+    buf.put("cd", meta.cd.data(), {npts});
+    buf.end_record();
 #else
-    amrex::ignore_unused(ncfile, meta, info, grid, time);
+    amrex::ignore_unused(buf, meta, info, grid, time);
 #endif
 }
 
@@ -832,4 +832,32 @@ TEST_F(FreeSurfaceTest, point_diffuse_in_single_phase)
     EXPECT_NEAR(ht, ht_est, 5e-2);
 }
 
+TEST_F(FreeSurfaceTest, box_face)
+{
+    // Split the domain into boxes of 16 cells so that the water level lies on
+    // the face between two boxes and most boxes contain a single phase
+    {
+        amrex::ParmParse pp("amr");
+        pp.add("max_grid_size", 16);
+    }
+    initialize_mesh();
+    auto& repo = sim().repo();
+    auto& vof = repo.declare_field("vof", 1, 2);
+    setup_grid_2d(2);
+
+    const amrex::Real water_level = 60.0;
+    init_vof(vof, water_level);
+    auto& m_sim = sim();
+    FreeSurfaceImpl tool(m_sim);
+    tool.initialize("freesurface");
+    tool.update_sampling_locations();
+
+    // The first instance finds the water level and the second one, searching
+    // below it for the next interface, finds the bottom of the domain
+    int nout = tool.check_output(0, "~", water_level);
+    ASSERT_EQ(nout, npts * npts);
+    nout = tool.check_output(1, "~", m_problo[2]);
+    ASSERT_EQ(nout, npts * npts);
+}
+
 } // namespace amr_wind_tests
@@ -135,4 +135,122 @@ TEST(NetCDFUtils, var_io)
     }
 }
 
+TEST(NetCDFUtils, var_options)
+{
+    constexpr int num_points = 10;
+    ncutils::NCFile ncf =
+        ncutils::NCFile::create("test_varopts.nc", NC_DISKLESS | NC_NETCDF4);
+    ASSERT_GE(ncf.ncid, 0);
+
+    ncf.def_dim("nsteps", NC_UNLIMITED);
+    ncf.def_dim("nx", num_points);
+
+    std::vector<size_t> chunks(2);
+    int storage;
+
+    // Without options the variables are stored as without the options path
+    const ncutils::NCVarOptions no_opts;
+    auto plain = ncf.def_array("plain", NC_DOUBLE, {"nsteps", "nx"});
+    auto unlim = ncf.def_array("unlim", NC_DOUBLE, {"nsteps", "nx"}, no_opts);
+    auto fixed = ncf.def_array("fixed", NC_DOUBLE, {"nx"}, no_opts);
+    {
+        std::vector<size_t> plain_chunks(2);
+        int plain_storage;
+        ASSERT_EQ(
+            nc_inq_var_chunking(
+                ncf.ncid, plain.varid, &plain_storage, plain_chunks.data()),
+            NC_NOERR);
+        ASSERT_EQ(
+            nc_inq_var_chunking(
+                ncf.ncid, unlim.varid, &storage, chunks.data()),
+            NC_NOERR);
+        EXPECT_EQ(storage, plain_storage);
+        EXPECT_EQ(chunks, plain_chunks);
+
+        ASSERT_EQ(
+            nc_inq_var_chunking(ncf.ncid, fixed.varid, &storage, nullptr),
+            NC_NOERR);
+        EXPECT_EQ(storage, NC_CONTIGUOUS);
+
+        int shuffle;
+        int deflate;
+        ASSERT_EQ(
+            nc_inq_var_deflate(
+                ncf.ncid, unlim.varid, &shuffle, &deflate, nullptr),
+            NC_NOERR);
+        EXPECT_EQ(deflate, 0);
+    }
+
+    // Explicit chunk shape
+    {
+        ncutils::NCVarOptions opts;
+        opts.chunks = {4, 5};
+        auto var = ncf.def_array("chunked", NC_DOUBLE, {"nsteps", "nx"}, opts);
+        ASSERT_EQ(
+            nc_inq_var_chunking(ncf.ncid, var.varid, &storage, chunks.data()),
+            NC_NOERR);
+        EXPECT_EQ(storage, NC_CHUNKED);
+        EXPECT_EQ(chunks, opts.chunks);
+    }
+
+    // Number of records per chunk
+    {
+        ncutils::NCVarOptions opts;
+        opts.record_chunk = 7;
+        auto var = ncf.def_array("records", NC_DOUBLE, {"nsteps", "nx"}, opts);
+        ASSERT_EQ(
+            nc_inq_var_chunking(ncf.ncid, var.varid, &storage, chunks.data()),
+            NC_NOERR);
+        EXPECT_EQ(storage, NC_CHUNKED);
+        EXPECT_EQ(chunks[0], 7U);
+        EXPECT_EQ(chunks[1], num_points);
+    }
+
+    // Compression selects the number of records from the size of a record
+    {
+        ncutils::NCVarOptions opts;
+        opts.deflate_level = 4;
+        opts.shuffle = false;
+        auto var =
+            ncf.def_array("compressed", NC_DOUBLE, {"nsteps", "nx"}, opts);
+        ASSERT_EQ(
+            nc_inq_var_chunking(ncf.ncid, var.varid, &storage, chunks.data()),
+            NC_NOERR);
+        EXPECT_EQ(storage, NC_CHUNKED);
+        EXPECT_EQ(chunks[0], 64 * 1024 / (num_points * sizeof(double)));
+        EXPECT_EQ(chunks[1], num_points);
+
+        int shuffle;
+        int deflate;
+        int level;
+        ASSERT_EQ(
+            nc_inq_var_deflate(ncf.ncid, var.varid, &shuffle, &deflate, &level),
+            NC_NOERR);
+        EXPECT_EQ(shuffle, 0);
+        EXPECT_EQ(deflate, 1);
+        EXPECT_EQ(level, 4);
+    }
+
+    // Single precision storage of double precision data
+    {
+        ncutils::NCVarOptions opts;
+        opts.single_precision = true;
+        auto var = ncf.def_array("single", NC_DOUBLE, {"nx"}, opts);
+        nc_type vtype;
+        ASSERT_EQ(nc_inq_vartype(ncf.ncid, var.varid, &vtype), NC_NOERR);
+        EXPECT_EQ(vtype, NC_FLOAT);
+
+        std::vector<double> values(num_points);
+        for (int i = 0; i < num_points; ++i) {
+            values[i] = 0.5 * i;
+        }
+        var.put(values.data());
+        std::vector<double> buf(num_points, 0.0);
+        var.get(buf.data());
+        for (int i = 0; i < num_points; ++i) {
+            EXPECT_EQ(buf[i], values[i]);
+        }
+    }
+}
+
 } // namespace amr_wind_tests
@@ -2,9 +2,52 @@
 #include "aw_test_utils/MeshTest.H"
 #include "amr-wind/CFDSim.H"
 #include "amr-wind/utilities/PostProcessing.H"
+#include "amr-wind/incflo.H"
+#include "AMReX_FileSystem.H"
 
 namespace amr_wind_tests {
 
+namespace {
+
+//! Post-processing utility recording whether the last checkpoint exists when
+//! its outputs held in memory are written
+class FlushOrderCheck
+    : public amr_wind::PostProcessBase::Register<FlushOrderCheck>
+{
+public:
+    static std::string identifier() { return "FlushOrderCheck"; }
+
+    FlushOrderCheck(amr_wind::CFDSim& sim, const std::string& /*label*/)
+        : m_sim(sim)
+    {}
+
+    void pre_init_actions() override {}
+    void initialize() override {}
+    void post_advance_work() override {}
+    void output_actions() override {}
+    void post_regrid_actions() override {}
+
+    void flush_outputs() override
+    {
+        ++num_flushes;
+        checkpoint_exists = amrex::FileExists(
+            amrex::Concatenate(chk_prefix, m_sim.time().time_index()));
+    }
+
+    static const std::string chk_prefix;
+    static int num_flushes;
+    static bool checkpoint_exists;
+
+private:
+    amr_wind::CFDSim& m_sim;
+};
+
+const std::string FlushOrderCheck::chk_prefix{"chk_flush_order"};
+int FlushOrderCheck::num_flushes = 0;
+bool FlushOrderCheck::checkpoint_exists = false;
+
+} // namespace
+
 class PostProcTimeTest : public MeshTest
 {
 protected:
@@ -299,4 +342,53 @@ TEST_F(PostProcTimeTest, conflict_fails)
     EXPECT_THROW(post_manager.post_init_actions(), std::runtime_error);
 }
 
+TEST_F(PostProcTimeTest, flush_before_last_checkpoint)
+{
+    populate_parameters();
+    {
+        amrex::ParmParse pp("time");
+        pp.add("checkpoint_interval", 2);
+        pp.add("checkpoint_start", 0);
+    }
+    {
+        amrex::ParmParse pp("io");
+        pp.add("check_file", FlushOrderCheck::chk_prefix);
+    }
+    {
+        amrex::ParmParse pp("incflo");
+        pp.add("post_processing", (std::string) "flush_check");
+    }
+    {
+        amrex::ParmParse pp("flush_check");
+        pp.add("type", (std::string) "FlushOrderCheck");
+    }
+    initialize_mesh();
+
+    incflo my_incflo;
+    my_incflo.init_mesh();
+
+    // The last checkpoint is written at a step that is not a multiple of the
+    // checkpoint interval
+    my_incflo.sim().time().set_restart_time(1, 0.1);
+    const std::string chkname =
+        amrex::Concatenate(FlushOrderCheck::chk_prefix, 1);
+    if (amrex::ParallelDescriptor::IOProcessor()) {
+        amrex::FileSystem::RemoveAll(chkname);
+    }
+    amrex::ParallelDescriptor::Barrier();
+
+    FlushOrderCheck::num_flushes = 0;
+    FlushOrderCheck::checkpoint_exists = true;
+    my_incflo.write_final_output();
+    amrex::ParallelDescriptor::Barrier();
+
+    EXPECT_EQ(FlushOrderCheck::num_flushes, 1);
+    EXPECT_FALSE(FlushOrderCheck::checkpoint_exists);
+    EXPECT_TRUE(amrex::FileExists(chkname));
+
+    if (amrex::ParallelDescriptor::IOProcessor()) {
+        amrex::FileSystem::RemoveAll(chkname);
+    }
+}
+
 } // namespace amr_wind_tests
\ No newline at end of file
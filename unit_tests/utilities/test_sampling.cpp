@@ -3,6 +3,7 @@
 
 #include "amr-wind/utilities/sampling/Sampling.H"
 #include "amr-wind/utilities/sampling/SamplingContainer.H"
+#include "amr-wind/utilities/sampling/LineSampler.H"
 #include "amr-wind/utilities/sampling/ProbeSampler.H"
 #include "amr-wind/utilities/sampling/PlaneSampler.H"
 #include "amr-wind/utilities/sampling/VolumeSampler.H"
@@ -12,6 +13,7 @@
 #include "AMReX_Vector.H"
 #include "amr-wind/core/vs/vector_space.H"
 #include "amr-wind/utilities/tensor_ops.H"
+#include "amr-wind/utilities/index_operations.H"
 
 namespace amr_wind_tests {
 
@@ -82,13 +84,14 @@ public:
 
     bool write_flag{false};
 
+    std::vector<double> buf;
+
 protected:
     void prepare_netcdf_file() override {}
     void process_output() override
     {
         // Test buffer populate for GPU runs
-        std::vector<double> buf(
-            num_total_particles() * var_names().size(), 0.0);
+        buf.assign(num_total_particles() * var_names().size(), 0.0);
         sampling_container().populate_buffer(buf);
 
         write_flag = true;
@@ -156,6 +159,20 @@ void test_scontainer_impl(
     amrex::Gpu::streamSynchronize();
 }
 
+class MovingLineSampler : public amr_wind::sampling::LineSampler
+{
+public:
+    explicit MovingLineSampler(const amr_wind::CFDSim& sim)
+        : amr_wind::sampling::LineSampler(sim)
+    {}
+
+    void shift(const amrex::Real dx)
+    {
+        m_start[0] += dx;
+        m_end[0] += dx;
+    }
+};
+
 } // namespace
 
 TEST_F(SamplingTest, scontainer)
@@ -195,6 +212,246 @@ TEST_F(SamplingTest, scontainer)
     ASSERT_EQ(counter, 4);
 }
 
+TEST_F(SamplingTest, scontainer_initialize)
+{
+    initialize_mesh();
+
+    {
+        amrex::ParmParse pp("sampling.plane1");
+        pp.addarr("axis1", amrex::Vector<amrex::Real>{126.0, 0.0, 0.0});
+        pp.addarr("axis2", amrex::Vector<amrex::Real>{0.0, 0.0, 126.0});
+        pp.addarr("origin", amrex::Vector<amrex::Real>{1.0, 66.0, 1.0});
+        pp.addarr("num_points", amrex::Vector<int>{8, 10});
+    }
+    {
+        amrex::ParmParse pp("sampling.line1");
+        pp.add("num_points", 16);
+        pp.addarr("start", amrex::Vector<amrex::Real>{10.0, 1.0, 66.0});
+        pp.addarr("end", amrex::Vector<amrex::Real>{10.0, 127.0, 66.0});
+    }
+
+    amrex::Vector<std::unique_ptr<amr_wind::sampling::SamplerBase>> samplers;
+    samplers.emplace_back(
+        std::make_unique<amr_wind::sampling::PlaneSampler>(sim()));
+    samplers.emplace_back(
+        std::make_unique<amr_wind::sampling::LineSampler>(sim()));
+    samplers[0]->label() = "plane1";
+    samplers[1]->label() = "line1";
+    for (int i = 0; i < 2; ++i) {
+        samplers[i]->id() = i;
+        samplers[i]->initialize("sampling." + samplers[i]->label());
+    }
+
+    amr_wind::sampling::SamplingContainer sc(mesh());
+    sc.setup_container(1);
+    sc.initialize_particles(samplers);
+    EXPECT_EQ(sc.num_sampling_particles(), 96);
+    EXPECT_EQ(sc.TotalNumberOfParticles(), 96);
+
+    // Every particle is placed in the tile that contains it and carries the
+    // global id of its sampler point
+    using IIx = amr_wind::sampling::IIx;
+    const auto& dxinv = mesh().Geom(0).InvCellSizeArray();
+    const auto& plo = mesh().Geom(0).ProbLoArray();
+    int nerr = 0;
+    for (amr_wind::sampling::SamplingContainer::ParIterType pti(sc, 0);
+         pti.isValid(); ++pti) {
+        const auto& box = pti.tilebox();
+        const int np = pti.numParticles();
+        const auto& pvec = pti.GetArrayOfStructs()();
+        amrex::Vector<amr_wind::sampling::SamplingContainer::ParticleType>
+            particles(np);
+        amrex::Gpu::copy(
+            amrex::Gpu::deviceToHost, pvec.begin(), pvec.end(),
+            particles.begin());
+        for (const auto& p : particles) {
+            const amrex::RealVect loc(
+                AMREX_D_DECL(p.pos(0), p.pos(1), p.pos(2)));
+            nerr += amr_wind::utils::contains(box, loc, plo, dxinv) ? 0 : 1;
+            const int uid_offset = (p.idata(IIx::sid) == 0) ? 0 : 80;
+            nerr += (p.idata(IIx::uid) == p.idata(IIx::nid) + uid_offset) ? 0
+                                                                          : 1;
+        }
+    }
+    amrex::ParallelDescriptor::ReduceIntSum(nerr);
+    EXPECT_EQ(nerr, 0);
+}
+
+TEST_F(SamplingTest, scontainer_block_buffer)
+{
+    initialize_mesh();
+
+    {
+        amrex::ParmParse pp("sampling.line1");
+        pp.add("num_points", 16);
+        pp.addarr("start", amrex::Vector<amrex::Real>{10.0, 1.0, 66.0});
+        pp.addarr("end", amrex::Vector<amrex::Real>{10.0, 127.0, 66.0});
+    }
+    {
+        amrex::ParmParse pp("sampling.line2");
+        pp.add("num_points", 21);
+        pp.addarr("start", amrex::Vector<amrex::Real>{1.0, 10.0, 66.0});
+        pp.addarr("end", amrex::Vector<amrex::Real>{127.0, 10.0, 66.0});
+    }
+
+    amrex::Vector<std::unique_ptr<amr_wind::sampling::SamplerBase>> samplers;
+    for (int i = 0; i < 2; ++i) {
+        samplers.emplace_back(
+            std::make_unique<amr_wind::sampling::LineSampler>(sim()));
+        samplers[i]->label() = "line" + std::to_string(i + 1);
+        samplers[i]->id() = i;
+        samplers[i]->initialize("sampling." + samplers[i]->label());
+    }
+
+    amr_wind::sampling::SamplingContainer sc(mesh());
+    sc.setup_container(2);
+    sc.initialize_particles(samplers);
+
+    // Store the particle UID and its square as the sampled values
+    using IIx = amr_wind::sampling::IIx;
+    for (amr_wind::sampling::SamplingContainer::ParIterType pti(sc, 0);
+         pti.isValid(); ++pti) {
+        const int np = pti.numParticles();
+        auto* pstruct = pti.GetArrayOfStructs()().data();
+        auto* v0 = pti.GetStructOfArrays().GetRealData(0).data();
+        auto* v1 = pti.GetStructOfArrays().GetRealData(1).data();
+        amrex::ParallelFor(np, [=] AMREX_GPU_DEVICE(const int ip) noexcept {
+            const amrex::Real uid = pstruct[ip].idata(IIx::uid);
+            v0[ip] = uid;
+            v1[ip] = uid * uid;
+        });
+    }
+
+    std::vector<double> buf;
+    const auto [start, count] = sc.populate_block_buffer(buf);
+    // Failures are counted rather than asserted so that every rank reaches
+    // the collective reductions below
+    int nerr = (static_cast<long>(buf.size()) == 2 * count) ? 0 : 1;
+    for (long i = 0; (nerr == 0) && (i < count); ++i) {
+        const auto uid = static_cast<double>(start + i);
+        nerr += (buf[i] == uid) ? 0 : 1;
+        nerr += (buf[count + i] == uid * uid) ? 0 : 1;
+    }
+    amrex::ParallelDescriptor::ReduceIntSum(nerr);
+    EXPECT_EQ(nerr, 0);
+
+    long ntotal = count;
+    amrex::ParallelDescriptor::ReduceLongSum(ntotal);
+    EXPECT_EQ(ntotal, 37);
+
+    // Records of several time steps are communicated at once
+    std::vector<double> records;
+    std::vector<long> nlocal;
+    nlocal.push_back(sc.pack_records(records));
+    nlocal.push_back(sc.pack_records(records));
+
+    std::vector<double> mbuf;
+    const auto [mstart, mcount] =
+        sc.populate_block_buffer(records, nlocal, mbuf);
+    int nerr_records = ((mstart == start) && (mcount == count) &&
+                        (mbuf.size() == 2 * buf.size()))
+                           ? 0
+                           : 1;
+    for (size_t i = 0; (nerr_records == 0) && (i < mbuf.size()); ++i) {
+        nerr_records += (mbuf[i] == buf[i % buf.size()]) ? 0 : 1;
+    }
+
+    std::vector<double> gbuf;
+    sc.populate_buffer(records, nlocal, gbuf);
+    if (amrex::ParallelDescriptor::IOProcessor()) {
+        if (gbuf.size() == 2 * 2 * 37) {
+            for (int is = 0; is < 2; ++is) {
+                for (long uid = 0; uid < 37; ++uid) {
+                    const auto val = static_cast<double>(uid);
+                    nerr_records += (gbuf[is * 74 + uid] == val) ? 0 : 1;
+                    nerr_records +=
+                        (gbuf[is * 74 + 37 + uid] == val * val) ? 0 : 1;
+                }
+            }
+        } else {
+            ++nerr_records;
+        }
+    }
+    amrex::ParallelDescriptor::ReduceIntSum(nerr_records);
+    EXPECT_EQ(nerr_records, 0);
+
+    // Every UID is owned by the processor whose block contains it
+    using SC = amr_wind::sampling::SamplingContainer;
+    for (const int nprocs : {1, 3, 7, 64}) {
+        for (long uid = 0; uid < 37; ++uid) {
+            const int owner = SC::uid_block_owner(uid, 37, nprocs);
+            EXPECT_LE(SC::uid_block_start(owner, 37, nprocs), uid);
+            EXPECT_GT(SC::uid_block_start(owner + 1, 37, nprocs), uid);
+        }
+    }
+}
+
+TEST_F(SamplingTest, scontainer_relocation)
+{
+    initialize_mesh();
+
+    {
+        amrex::ParmParse pp("sampling.line1");
+        pp.add("num_points", 16);
+        pp.addarr("start", amrex::Vector<amrex::Real>{10.0, 66.0, 1.0});
+        pp.addarr("end", amrex::Vector<amrex::Real>{10.0, 66.0, 127.0});
+    }
+    {
+        amrex::ParmParse pp("sampling.line2");
+        pp.add("num_points", 12);
+        pp.addarr("start", amrex::Vector<amrex::Real>{1.0, 10.0, 66.0});
+        pp.addarr("end", amrex::Vector<amrex::Real>{127.0, 10.0, 66.0});
+    }
+
+    amrex::Vector<std::unique_ptr<amr_wind::sampling::SamplerBase>> samplers;
+    for (const std::string lbl : {"line1", "line2"}) {
+        auto obj = std::make_unique<MovingLineSampler>(sim());
+        obj->label() = lbl;
+        obj->id() = static_cast<int>(samplers.size());
+        obj->initialize("sampling." + lbl);
+        samplers.emplace_back(std::move(obj));
+    }
+
+    amr_wind::sampling::SamplingContainer sc(mesh());
+    sc.setup_container(1);
+    sc.initialize_particles(samplers);
+    sc.Redistribute();
+
+    // Move the first line across several boxes and relocate its particles
+    dynamic_cast<MovingLineSampler&>(*samplers[0]).shift(90.0);
+    EXPECT_TRUE(sc.update_particle_locations(samplers, {0}));
+    EXPECT_EQ(sc.TotalNumberOfParticles(), 28);
+
+    amr_wind::sampling::SampleLocType locs1;
+    amr_wind::sampling::SampleLocType locs2;
+    samplers[0]->sampling_locations(locs1);
+    samplers[1]->sampling_locations(locs2);
+
+    using IIx = amr_wind::sampling::IIx;
+    const amrex::Real tol = 1.0e-12;
+    int nerr = 0;
+    for (amr_wind::sampling::SamplingContainer::ParIterType pti(sc, 0);
+         pti.isValid(); ++pti) {
+        const int np = pti.numParticles();
+        const auto& pvec = pti.GetArrayOfStructs()();
+        amrex::Vector<amr_wind::sampling::SamplingContainer::ParticleType>
+            particles(np);
+        amrex::Gpu::copy(
+            amrex::Gpu::deviceToHost, pvec.begin(), pvec.end(),
+            particles.begin());
+        for (const auto& p : particles) {
+            const auto& locs = (p.idata(IIx::sid) == 0) ? locs1.locations()
+                                                        : locs2.locations();
+            const auto& loc = locs[p.idata(IIx::nid)];
+            for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+                nerr += (std::abs(p.pos(d) - loc[d]) > tol) ? 1 : 0;
+            }
+        }
+    }
+    amrex::ParallelDescriptor::ReduceIntSum(nerr);
+    EXPECT_EQ(nerr, 0);
+}
+
 TEST_F(SamplingTest, sampling)
 {
     initialize_mesh();
@@ -216,7 +473,8 @@ TEST_F(SamplingTest, sampling)
             "fields",
             amrex::Vector<std::string>{"density", "pressure", "velocity"});
         pp.addarr(
-            "derived_fields", amrex::Vector<std::string>{"mag_vorticity"});
+            "derived_fields",
+            amrex::Vector<std::string>{"mag_vorticity", "grad(density)"});
         pp.addarr("int_fields", amrex::Vector<std::string>{"idxsum"});
     }
     {
@@ -232,6 +490,32 @@ TEST_F(SamplingTest, sampling)
     probes.output_actions();
 
     EXPECT_TRUE(probes.write_flag);
+
+    // The gathered buffer is ordered by UID on the IO processor. Density,
+    // pressure, and the velocity components are all linear functions
+    // interpolated in the same pass with cell and node stencils.
+    if (amrex::ParallelDescriptor::IOProcessor()) {
+        const int npts = 16;
+        const int nvars = 5;
+        const amrex::Real tol = 1.0e-10;
+        for (int iv = 0; iv < nvars; ++iv) {
+            for (int n = 0; n < npts; ++n) {
+                const amrex::Real z = 1.0 + n * 126.0 / (npts - 1);
+                EXPECT_NEAR(probes.buf[iv * npts + n], 132.0 + z, tol);
+            }
+        }
+
+        // Derived quantities are evaluated at the cells around the probes:
+        // the vorticity of the linear velocity field vanishes and the density
+        // gradient is uniform
+        const int ivort = 6;
+        for (int n = 0; n < npts; ++n) {
+            EXPECT_NEAR(probes.buf[ivort * npts + n], 0.0, tol);
+            for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+                EXPECT_NEAR(probes.buf[(ivort + 1 + d) * npts + n], 1.0, tol);
+            }
+        }
+    }
 }
 
 TEST_F(SamplingTest, sampling_timing)
@@ -432,6 +716,31 @@ TEST_F(SamplingTest, radar_sampler)
     ASSERT_EQ(sample_locs.locations().size(), 193536);
 }
 
+TEST_F(SamplingTest, radar_line_average)
+{
+    const std::vector<double> h_weights{1.0, 3.0, 0.0};
+    const std::vector<double> h_values{1.0, 2.0, 7.0, 3.0, 5.0, -1.0};
+    amrex::Gpu::DeviceVector<double> weights(h_weights.size());
+    amrex::Gpu::DeviceVector<double> values(h_values.size());
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, h_weights.begin(), h_weights.end(),
+        weights.begin());
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, h_values.begin(), h_values.end(),
+        values.begin());
+
+    amrex::Gpu::DeviceVector<double> reduced;
+    amr_wind::sampling::RadarSampler::line_average(weights, values, reduced);
+    ASSERT_EQ(reduced.size(), 2);
+
+    std::vector<double> h_reduced(reduced.size());
+    amrex::Gpu::copy(
+        amrex::Gpu::deviceToHost, reduced.begin(), reduced.end(),
+        h_reduced.begin());
+    EXPECT_NEAR(h_reduced[0], 1.75, 1.0e-12);
+    EXPECT_NEAR(h_reduced[1], 4.5, 1.0e-12);
+}
+
 TEST_F(SamplingTest, sampling_utils)
 {
     namespace vs = amr_wind::vs;
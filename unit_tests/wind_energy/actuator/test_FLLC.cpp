@@ -66,4 +66,142 @@ TEST(TestFLLCData, data_initializes_with_cviews_nonuniform)
     ASSERT_EQ(npts_r, npts_dr);
 }
 
+namespace {
+
+struct FLLCTestBlade
+{
+    explicit FLLCTestBlade(const int npts)
+        : pos(npts), force(npts), vel(npts), vel_rel(npts), chord(npts)
+    {
+        for (int ip = 0; ip < npts; ++ip) {
+            const amrex::Real y = 1.0 + 0.5 * ip;
+            pos[ip] = vs::Vector{0.1 * std::sin(0.3 * ip), y, 0.0};
+            force[ip] = vs::Vector{1.0 + 0.2 * ip, 0.1, 2.0 - 0.1 * ip};
+            vel[ip] = vs::Vector{8.0, 0.0, 0.5};
+            vel_rel[ip] = vs::Vector{8.0, 0.2 * y, 0.5};
+            chord[ip] = 1.5 - 0.05 * ip;
+        }
+        view.pos = ::amr_wind::utils::slice(pos, 0, npts);
+        view.vel_pos = ::amr_wind::utils::slice(pos, 0, npts);
+        view.force = ::amr_wind::utils::slice(force, 0, npts);
+        view.vel = ::amr_wind::utils::slice(vel, 0, npts);
+        view.vel_rel = ::amr_wind::utils::slice(vel_rel, 0, npts);
+        view.chord = ::amr_wind::utils::slice(chord, 0, npts);
+    }
+
+    VecList pos;
+    VecList force;
+    VecList vel;
+    VecList vel_rel;
+    RealList chord;
+    ComponentView view;
+};
+
+VecList lift_distribution(const FLLCTestBlade& blade, const FLLCData& fllc)
+{
+    const int npts = static_cast<int>(blade.pos.size());
+    VecList G(npts);
+    for (int ip = 0; ip < npts; ++ip) {
+        const auto& force = blade.force[ip];
+        const auto& vel = blade.vel_rel[ip];
+        const auto vmag2 = vs::mag_sqr(vel);
+        G[ip] = (force - vel * (force & vel) / vmag2) / fllc.dr[ip];
+    }
+    return G;
+}
+
+} // namespace
+
+TEST(TestFLLCOp, constant_chord_matches_pairwise_sum)
+{
+    const int npts = 16;
+    FLLCTestBlade blade(npts);
+    FLLCData fllc;
+    fllc.correction_type = FLLCType::ConstantChord;
+    fllc.nonuniform = false;
+    fllc.epsilon = 2.0;
+    fllc.relaxation_factor = 1.0;
+    fllc_init(fllc, blade.view, 0.25);
+
+    const auto G = lift_distribution(blade, fllc);
+    VecList dG(npts);
+    dG[0] = G[0];
+    dG[npts - 1] = -1.0 * G[npts - 1];
+    for (int ip = 1; ip < npts - 1; ++ip) {
+        dG[ip] = 0.5 * (G[ip + 1] - G[ip - 1]);
+    }
+
+    VecList vel_ref(blade.vel);
+    for (int ip = 0; ip < npts; ++ip) {
+        const auto eps_les = fllc.epsilon;
+        const auto eps_opt = fllc.optimal_epsilon[ip];
+        vs::Vector du = vs::Vector::zero();
+        for (int jp = 0; jp < npts; ++jp) {
+            if (ip == jp) {
+                continue;
+            }
+            const auto r = vs::mag(blade.pos[ip] - blade.pos[jp]);
+            const auto vmag = vs::mag(blade.vel_rel[jp]);
+            const amrex::Real sign = (ip < jp) ? -1.0 : 1.0;
+            const auto coeff =
+                sign / (-4.0 * ::amr_wind::utils::pi() * r * vmag);
+            const auto c_les = 1.0 - std::exp(-r * r / (eps_les * eps_les));
+            const auto c_opt = 1.0 - std::exp(-r * r / (eps_opt * eps_opt));
+            du = du - dG[jp] * coeff * (c_opt - c_les);
+        }
+        vel_ref[ip] = vel_ref[ip] + du;
+    }
+
+    FLLCOp()(blade.view, fllc);
+    for (int ip = 0; ip < npts; ++ip) {
+        for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+            EXPECT_NEAR(blade.vel[ip][d], vel_ref[ip][d], 1.0e-12);
+        }
+    }
+}
+
+TEST(TestFLLCOp, variable_chord_matches_pairwise_sum)
+{
+    const int npts = 16;
+    FLLCTestBlade blade(npts);
+    FLLCData fllc;
+    fllc.correction_type = FLLCType::VariableChord;
+    fllc.nonuniform = false;
+    fllc.epsilon = 2.0;
+    fllc.relaxation_factor = 1.0;
+    fllc_init(fllc, blade.view, 0.25);
+
+    const auto G = lift_distribution(blade, fllc);
+
+    VecList vel_ref(blade.vel);
+    for (int ip = 0; ip < npts; ++ip) {
+        const auto eps_les2 = fllc.epsilon * fllc.epsilon;
+        vs::Vector du = vs::Vector::zero();
+        for (int jp = 0; jp < npts; ++jp) {
+            const auto eps_opt2 =
+                fllc.optimal_epsilon[jp] * fllc.optimal_epsilon[jp];
+            const auto r = vs::mag(blade.pos[ip] - blade.pos[jp]);
+            const auto vmag = vs::mag(blade.vel_rel[jp]);
+            amrex::Real k_les = 0.5 / eps_les2;
+            amrex::Real k_opt = 0.5 / eps_opt2;
+            if (r > 0.0) {
+                const auto exp_les = std::exp(-r * r / eps_les2);
+                const auto exp_opt = std::exp(-r * r / eps_opt2);
+                k_les = exp_les / eps_les2 + (exp_les - 1.0) / (2.0 * r * r);
+                k_opt = exp_opt / eps_opt2 + (exp_opt - 1.0) / (2.0 * r * r);
+            }
+            du = du + G[jp] * fllc.dr[jp] * (k_opt - k_les) /
+                          (2.0 * ::amr_wind::utils::pi() * vmag);
+        }
+        vel_ref[ip] = vel_ref[ip] + du;
+    }
+
+    FLLCOp()(blade.view, fllc);
+    for (int ip = 0; ip < npts; ++ip) {
+        for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+            EXPECT_NEAR(blade.vel[ip][d], vel_ref[ip][d], 1.0e-12);
+        }
+    }
+}
+
 } // namespace amr_wind::actuator
@@ -306,4 +306,76 @@ TEST_F(ActFlatPlateTest, flat_plate_init)
     act.pre_init_actions();
     act.post_init_actions();
 }
+
+TEST_F(ActFlatPlateTest, binned_spreading)
+{
+    initialize_mesh();
+    auto& src = sim().repo().declare_field("actuator_src_term", 3, 0);
+    auto& src_ref = sim().repo().declare_field("actuator_src_ref", 3, 0);
+    {
+        amrex::ParmParse pp("Actuator.TestFlatPlateLine");
+        pp.add("num_points", 11);
+        pp.addarr("start", amrex::Vector<amrex::Real>{16.0, 12.0, 16.0});
+        pp.addarr("end", amrex::Vector<amrex::Real>{16.0, 20.0, 16.0});
+        pp.addarr("epsilon", amrex::Vector<amrex::Real>{2.0, 2.0, 2.0});
+        pp.add("pitch", 6.0);
+    }
+    {
+        amrex::ParmParse pp("Actuator.F2");
+        pp.add("binned_spreading", true);
+    }
+
+    namespace ops = amr_wind::actuator::ops;
+    using SrcOp = ops::ActSrcOp<FlatPlate, act::ActSrcLine>;
+    FlatPlate::DataType dense_data(sim(), "F1", 0);
+    FlatPlate::DataType binned_data(sim(), "F2", 1);
+    SrcOp dense_op(dense_data);
+    SrcOp binned_op(binned_data);
+
+    auto setup = [](auto& data, SrcOp& op, const std::string& label) {
+        act::utils::ActParser pp(
+            "Actuator.TestFlatPlateLine", "Actuator." + label);
+        ops::ReadInputsOp<FlatPlate, act::ActSrcLine>()(data, pp);
+        op.read_inputs(pp);
+        // Cover the whole domain so that only the binning is being tested
+        data.info().bound_box =
+            amrex::RealBox(0.0, 0.0, 0.0, 32.0, 32.0, 32.0);
+        ops::InitDataOp<FlatPlate, act::ActSrcLine>()(data);
+        op.initialize();
+
+        auto& grid = data.grid();
+        const int npts = static_cast<int>(grid.pos.size());
+        for (int ip = 0; ip < npts; ++ip) {
+            grid.force[ip] = vs::Vector{1.0 + ip, -0.5 * ip, 2.0};
+        }
+        op.setup_op();
+    };
+    setup(dense_data, dense_op, "F1");
+    setup(binned_data, binned_op, "F2");
+
+    auto spread = [&](SrcOp& op) {
+        src.setVal(0.0);
+        for (int lev = 0; lev < sim().repo().num_active_levels(); ++lev) {
+            const auto& geom = sim().mesh().Geom(lev);
+            for (amrex::MFIter mfi(src(lev)); mfi.isValid(); ++mfi) {
+                op(lev, mfi, geom);
+            }
+        }
+    };
+
+    spread(dense_op);
+    for (int lev = 0; lev < sim().repo().num_active_levels(); ++lev) {
+        amrex::MultiFab::Copy(src_ref(lev), src(lev), 0, 0, 3, 0);
+    }
+    spread(binned_op);
+
+    for (int lev = 0; lev < sim().repo().num_active_levels(); ++lev) {
+        const amrex::Real ref_max = src_ref(lev).norm0(0);
+        EXPECT_GT(ref_max, 0.0);
+        amrex::MultiFab::Subtract(src(lev), src_ref(lev), 0, 0, 3, 0);
+        for (int n = 0; n < 3; ++n) {
+            EXPECT_NEAR(src(lev).norm0(n), 0.0, 1.0e-12 * ref_max);
+        }
+    }
+}
 } // namespace amr_wind_tests
@@ -2,6 +2,7 @@
 #include "amr-wind/utilities/trig_ops.H"
 #include "amr-wind/core/vs/vector_space.H"
 #include "amr-wind/wind_energy/actuator/actuator_utils.H"
+#include "amr-wind/wind_energy/actuator/actuator_types.H"
 #include <cmath>
 
 namespace act = ::amr_wind::actuator::utils;
@@ -100,5 +101,107 @@ TEST(CylindricalTransformation, distances_on_rotated_shifted_circle)
     EXPECT_DOUBLE_EQ(1.0, d[2]);
 }
 
+TEST(ActuatorRootProc, load_aware_assignment)
+{
+    const amrex::Vector<amrex::Real> mesh_load{2.5, 0.5, 1.0};
+    amrex::Vector<int> act_proc_count(mesh_load.size(), 0);
+    const amrex::Real cost = 1.0;
+
+    // Least loaded free proc amongst the influenced procs
+    ::amr_wind::actuator::ActInfo t1("T1", 0);
+    t1.procs = {0, 1, 2};
+    act::determine_root_proc(t1, act_proc_count, mesh_load, cost);
+    EXPECT_EQ(t1.root_proc, 1);
+
+    ::amr_wind::actuator::ActInfo t2("T2", 1);
+    t2.procs = {0, 1, 2};
+    act::determine_root_proc(t2, act_proc_count, mesh_load, cost);
+    EXPECT_EQ(t2.root_proc, 2);
+
+    // All influenced procs are busy, choose the lowest combined cost
+    ::amr_wind::actuator::ActInfo t3("T3", 2);
+    t3.procs = {1, 2};
+    act::determine_root_proc(t3, act_proc_count, mesh_load, cost);
+    EXPECT_EQ(t3.root_proc, 1);
+
+    ::amr_wind::actuator::ActInfo t4("T4", 3);
+    t4.procs = {1};
+    act::determine_root_proc(t4, act_proc_count, mesh_load, cost);
+    EXPECT_EQ(t4.root_proc, 2);
+    EXPECT_TRUE(t4.procs.find(2) != t4.procs.end());
+
+    // Flags of this rank
+    const int iproc = amrex::ParallelDescriptor::MyProc();
+    EXPECT_EQ(t4.is_root_proc, iproc == 2);
+    EXPECT_EQ(t4.actuator_in_proc, t4.procs.count(iproc) > 0);
+    EXPECT_EQ(t4.sample_vel_in_proc, t4.actuator_in_proc);
+
+    EXPECT_EQ(act_proc_count[0], 0);
+    EXPECT_EQ(act_proc_count[1], 2);
+    EXPECT_EQ(act_proc_count[2], 2);
+}
+
+TEST(ActuatorOutputBuffer, records_layout)
+{
+    act::ActOutputBuffer buf;
+    buf.initialize("T1.nc", "T1");
+    buf.set_capacity(2);
+    EXPECT_TRUE(buf.empty());
+
+    for (int it = 0; it < 2; ++it) {
+        const amrex::Real time = 0.5 * (it + 1);
+        const vs::Vector force{1.0 * it, 2.0 * it, 3.0 * it};
+        const amrex::Vector<amrex::Real> cl{10.0 + it, 20.0 + it};
+        EXPECT_FALSE(buf.full());
+        buf.put("time", &time);
+        buf.put("force", force.data(), {AMREX_SPACEDIM});
+        buf.put("cl", cl.data(), {2});
+        buf.end_record();
+    }
+    EXPECT_TRUE(buf.full());
+
+    const auto recs = buf.release();
+    EXPECT_TRUE(buf.empty());
+    EXPECT_EQ(recs.ncfile, "T1.nc");
+    EXPECT_EQ(recs.group, "T1");
+    EXPECT_EQ(recs.num_records, 2);
+    ASSERT_EQ(recs.vars.size(), 3);
+
+    const auto& time = recs.vars[0];
+    EXPECT_EQ(time.name, "time");
+    EXPECT_TRUE(time.shape.empty());
+    ASSERT_EQ(time.data.size(), 2);
+    EXPECT_NEAR(time.data[0], 0.5, 1.0e-12);
+    EXPECT_NEAR(time.data[1], 1.0, 1.0e-12);
+
+    const auto& force = recs.vars[1];
+    EXPECT_EQ(force.name, "force");
+    ASSERT_EQ(force.data.size(), 2 * AMREX_SPACEDIM);
+    for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+        EXPECT_NEAR(force.data[i], 0.0, 1.0e-12);
+        EXPECT_NEAR(force.data[AMREX_SPACEDIM + i], i + 1.0, 1.0e-12);
+    }
+
+    const auto& cl = recs.vars[2];
+    EXPECT_EQ(cl.name, "cl");
+    ASSERT_EQ(cl.data.size(), 4);
+    EXPECT_NEAR(cl.data[1], 20.0, 1.0e-12);
+    EXPECT_NEAR(cl.data[2], 11.0, 1.0e-12);
+
+    // Variables are retained for the next batch of records
+    const amrex::Real time2 = 2.0;
+    const vs::Vector force2{0.0, 0.0, 0.0};
+    const amrex::Vector<amrex::Real> cl2{0.0, 0.0};
+    buf.put("time", &time2);
+    buf.put("force", force2.data(), {AMREX_SPACEDIM});
+    buf.put("cl", cl2.data(), {2});
+    buf.end_record();
+    const auto recs2 = buf.release();
+    EXPECT_EQ(recs2.num_records, 1);
+    ASSERT_EQ(recs2.vars.size(), 3);
+    ASSERT_EQ(recs2.vars[0].data.size(), 1);
+    EXPECT_NEAR(recs2.vars[0].data[0], 2.0, 1.0e-12);
+}
+
 } // namespace
 } // namespace amr_wind_tests::amr_wind
@@ -206,4 +206,79 @@ TEST_F(ActJoukowskyTest, execution)
     act.pre_init_actions();
     act.post_init_actions();
 }
+TEST_F(ActJoukowskyTest, cached_influence_map)
+{
+    initialize_domain();
+    basic_disk_setup();
+    add_actuators("TestJoukowskyDisk", {"D1"});
+    auto& src = sim().repo().get_field("actuator_src_term");
+    auto& src_ref = sim().repo().declare_field("actuator_src_ref", 3, 0);
+    {
+        ActPhysicsTest act(sim());
+        act.pre_init_actions();
+        act.post_init_actions();
+    }
+    for (int lev = 0; lev < sim().repo().num_active_levels(); ++lev) {
+        amrex::MultiFab::Copy(src_ref(lev), src(lev), 0, 0, 3, 0);
+    }
+
+    {
+        amrex::ParmParse pp("Actuator.TestJoukowskyDisk");
+        pp.add("cache_influence_map", true);
+    }
+    amr_wind::actuator::ActuatorContainer::ParticleType::NextID(1U);
+    {
+        ActPhysicsTest act(sim());
+        act.pre_init_actions();
+        act.post_init_actions();
+    }
+
+    for (int lev = 0; lev < sim().repo().num_active_levels(); ++lev) {
+        const amrex::Real ref_max = src_ref(lev).norm0(0);
+        EXPECT_GT(ref_max, 0.0);
+        amrex::MultiFab::Subtract(src(lev), src_ref(lev), 0, 0, 3, 0);
+        for (int n = 0; n < 3; ++n) {
+            EXPECT_NEAR(src(lev).norm0(n), 0.0, 1.0e-12 * ref_max);
+        }
+    }
+}
+
+TEST_F(ActJoukowskyTest, sparse_source_term)
+{
+    initialize_domain();
+    basic_disk_setup();
+    add_actuators("TestJoukowskyDisk", {"D1"});
+    auto& src = sim().repo().get_field("actuator_src_term");
+    auto& src_ref = sim().repo().declare_field("actuator_src_ref", 3, 1);
+    {
+        ActPhysicsTest act(sim());
+        act.pre_init_actions();
+        act.post_init_actions();
+    }
+    for (int lev = 0; lev < sim().repo().num_active_levels(); ++lev) {
+        amrex::MultiFab::Copy(src_ref(lev), src(lev), 0, 0, 3, 1);
+    }
+
+    // Pollute the field to ensure that all relevant boxes are reset
+    src.setVal(1.0);
+    {
+        amrex::ParmParse pp("Actuator");
+        pp.add("sparse_source", true);
+    }
+    amr_wind::actuator::ActuatorContainer::ParticleType::NextID(1U);
+    {
+        ActPhysicsTest act(sim());
+        act.pre_init_actions();
+        act.post_init_actions();
+    }
+
+    for (int lev = 0; lev < sim().repo().num_active_levels(); ++lev) {
+        const amrex::Real ref_max = src_ref(lev).norm0(0);
+        EXPECT_GT(ref_max, 0.0);
+        amrex::MultiFab::Subtract(src(lev), src_ref(lev), 0, 0, 3, 1);
+        for (int n = 0; n < 3; ++n) {
+            EXPECT_EQ(src(lev).norm0(n, 1), 0.0);
+        }
+    }
+}
 } // namespace amr_wind_tests
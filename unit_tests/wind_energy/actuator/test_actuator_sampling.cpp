@@ -168,4 +168,76 @@ TEST_F(ActuatorTest, act_container)
     }
 }
 
+TEST_F(ActuatorTest, act_container_incremental)
+{
+    const int nprocs = amrex::ParallelDescriptor::NProcs();
+    const int iproc = amrex::ParallelDescriptor::MyProc();
+    initialize_mesh();
+    auto& vel = sim().repo().declare_field("velocity", 3, 3);
+    auto& density = sim().repo().declare_field("density", 1, 3);
+    init_field(vel);
+    density.setVal(1.0);
+
+    const int num_turbines = 2;
+    const int num_nodes = 16;
+
+    TestActContainer ac_ref(mesh(), num_turbines);
+    TestActContainer ac_inc(mesh(), num_turbines);
+    ac_inc.use_incremental_migration(true);
+    for (auto* ac : {&ac_ref, &ac_inc}) {
+        auto& data = ac->get_data_obj();
+        for (int it = 0; it < num_turbines; ++it) {
+            data.num_pts[it] = num_nodes;
+        }
+        ac->initialize_container();
+    }
+
+    const amrex::Real dx = mesh().Geom(0).CellSize(0);
+    const amrex::Real dz = mesh().Geom(0).CellSize(2);
+    // Small displacements use the neighbor-only migration, the large one
+    // triggers a full redistribution
+    const amrex::Vector<amrex::Real> shifts{0.0, 0.3, 0.6, 1.4, 8.0, 8.3};
+    for (const auto shift : shifts) {
+        for (auto* ac : {&ac_ref, &ac_inc}) {
+            auto& pvec = ac->get_data_obj().position;
+            int idx = 0;
+            // Spread the points of the ranks across the domain so that the
+            // particles are held on several ranks for any rank count
+            const amrex::Real ypos = 128.0 * (iproc + 0.5) / nprocs;
+            for (int it = 0; it < num_turbines; ++it) {
+                const amrex::Real xpos = 32.0 * (it + 1) - 0.1 + shift * dx;
+                for (int ni = 0; ni < num_nodes; ++ni) {
+                    pvec[idx].x() = xpos;
+                    pvec[idx].y() = ypos;
+                    pvec[idx].z() = (ni + 0.5) * dz + 0.5 * shift * dz;
+                    ++idx;
+                }
+            }
+
+            ac->reset_container();
+            ac->update_positions();
+            ac->sample_fields(vel, density);
+        }
+
+        const auto& vref = ac_ref.get_data_obj().velocity;
+        const auto& vinc = ac_inc.get_data_obj().velocity;
+        const auto& dref = ac_ref.get_data_obj().density;
+        const auto& dinc = ac_inc.get_data_obj().density;
+        ASSERT_EQ(vref.size(), vinc.size());
+        for (int ip = 0; ip < static_cast<int>(vref.size()); ++ip) {
+            for (int n = 0; n < AMREX_SPACEDIM; ++n) {
+                EXPECT_EQ(vref[ip][n], vinc[ip][n]);
+            }
+            EXPECT_EQ(dref[ip], dinc[ip]);
+        }
+    }
+
+#ifndef AMREX_USE_GPU
+    // Particles are retained in the boxes across timesteps
+    ASSERT_EQ(
+        ac_inc.num_actuator_points() * nprocs,
+        ac_inc.NumberOfParticlesAtLevel(0));
+#endif
+}
+
 } // namespace amr_wind_tests
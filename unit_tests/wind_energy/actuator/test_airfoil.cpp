@@ -92,4 +92,42 @@ TEST(Airfoil, airfoil_lookup)
     }
 }
 
+TEST(Airfoil, uniform_airfoil_lookup)
+{
+    using AirfoilLoader = ::amr_wind::actuator::AirfoilLoader;
+    namespace utils = ::amr_wind::utils;
+    amrex::Vector<amrex::Real> aoa_test{-179.5, -40.0, -15.0, -5.0, 0.0,
+                                        5.0,    10.0,  15.0,  90.0, 181.0};
+    for (auto& aoa : aoa_test) {
+        aoa = utils::radians(aoa);
+    }
+    const int npts = static_cast<int>(aoa_test.size());
+
+    auto ss_ref = generate_txt_airfoil();
+    auto af_ref = AirfoilLoader::load_text_file(ss_ref);
+
+    for (const bool use_float : {false, true}) {
+        auto ss = generate_txt_airfoil();
+        auto af = AirfoilLoader::load_text_file(ss);
+        const amrex::Real tol = use_float ? 1.0e-6 : 1.0e-12;
+
+        const auto max_err =
+            af->resample_uniform(utils::radians(1.0), use_float);
+        EXPECT_TRUE(af->is_uniform());
+        EXPECT_NEAR(max_err, 0.0, tol);
+
+        amrex::Vector<amrex::Real> cl(npts), cd(npts);
+        (*af)(npts, aoa_test.data(), cl.data(), cd.data());
+        for (int i = 0; i < npts; ++i) {
+            amrex::Real cl_ref, cd_ref, cl_s, cd_s;
+            (*af_ref)(aoa_test[i], cl_ref, cd_ref);
+            (*af)(aoa_test[i], cl_s, cd_s);
+            EXPECT_NEAR(cl[i], cl_ref, tol);
+            EXPECT_NEAR(cd[i], cd_ref, tol);
+            EXPECT_EQ(cl[i], cl_s);
+            EXPECT_EQ(cd[i], cd_s);
+        }
+    }
+}
+
 } // namespace amr_wind_tests
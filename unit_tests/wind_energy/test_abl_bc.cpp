@@ -3,6 +3,7 @@
 #include "aw_test_utils/iter_tools.H"
 #include "aw_test_utils/test_utils.H"
 #include "amr-wind/incflo.H"
+#include "amr-wind/wind_energy/ABLBoundaryPlane.H"
 
 #include "AMReX_Gpu.H"
 #include "AMReX_Random.H"
@@ -265,4 +266,29 @@ TEST_F(ABLMeshTest, abl_donelan_wall_model)
     EXPECT_NEAR(vexpct, vbase, tol);
 }
 
+TEST(ABLBoundaryPlane, inlet_data_window)
+{
+    const amrex::Vector<amrex::Real> times{0.0, 1.0, 2.0, 3.0};
+    amr_wind::InletData inlet;
+    inlet.resize(2 * AMREX_SPACEDIM);
+
+    // The first window reads both time levels
+    EXPECT_TRUE(inlet.advance_window(0.5, times));
+    EXPECT_EQ(inlet.index_n(), 0);
+    EXPECT_NEAR(inlet.tn(), 0.0, 1e-12);
+    EXPECT_NEAR(inlet.tnp1(), 1.0, 1e-12);
+
+    // Marching forward reuses the planes at n + 1
+    EXPECT_FALSE(inlet.advance_window(1.5, times));
+    EXPECT_EQ(inlet.index_n(), 1);
+    EXPECT_NEAR(inlet.tn(), 1.0, 1e-12);
+    EXPECT_NEAR(inlet.tnp1(), 2.0, 1e-12);
+
+    // Going back or skipping a window reads both time levels
+    EXPECT_TRUE(inlet.advance_window(0.2, times));
+    EXPECT_EQ(inlet.index_n(), 0);
+    EXPECT_TRUE(inlet.advance_window(2.5, times));
+    EXPECT_EQ(inlet.index_n(), 2);
+}
+
 } // namespace amr_wind_tests
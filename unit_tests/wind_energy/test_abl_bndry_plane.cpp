@@ -0,0 +1,340 @@
+#include "aw_test_utils/MeshTest.H"
+#include "aw_test_utils/pp_utils.H"
+#include "amr-wind/wind_energy/ABLBoundaryPlane.H"
+#include "amr-wind/utilities/tagging/CartBoxRefinement.H"
+
+namespace amr_wind_tests {
+
+namespace {
+
+//! Number of time records in the boundary plane files
+constexpr int nrecords = 5;
+
+//! Value of the fields at a record, linear in time so that the
+//! interpolation between records is exact
+AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE amrex::Real
+plane_value(const amrex::Real time, const int j, const int k, const int n)
+{
+    return 10.0 * time + j + 0.1 * k + 0.01 * n;
+}
+
+void init_field(amr_wind::Field& fld, const amrex::Real time)
+{
+    const int nlevels = fld.repo().num_active_levels();
+    for (int lev = 0; lev < nlevels; ++lev) {
+        const auto& farrs = fld(lev).arrays();
+        amrex::ParallelFor(
+            fld(lev), fld.num_grow(), fld.num_comp(),
+            [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k, int n) noexcept {
+                farrs[nbx](i, j, k, n) = plane_value(time, j, k, n);
+            });
+    }
+    amrex::Gpu::streamSynchronize();
+}
+
+//! Maximum error of the data in the ghost cells at the xlo boundary
+amrex::Real xlo_error(const amrex::MultiFab& mfab, const amrex::Real time)
+{
+    const int nc = mfab.nComp();
+    amrex::Real error = amrex::ReduceMax(
+        mfab, 1,
+        [=] AMREX_GPU_HOST_DEVICE(
+            amrex::Box const& bx,
+            amrex::Array4<amrex::Real const> const& arr) -> amrex::Real {
+            amrex::Real err = 0.0;
+            amrex::Box gbx = amrex::grow(bx, -1);
+            if (gbx.smallEnd(0) != 0) {
+                return err;
+            }
+            gbx.setSmall(0, -1);
+            gbx.setBig(0, -1);
+            amrex::Loop(gbx, nc, [=, &err](int i, int j, int k, int n) {
+                const amrex::Real ref = plane_value(time, j, k, n);
+                err = amrex::max(err, std::abs(arr(i, j, k, n) - ref));
+            });
+            return err;
+        });
+    amrex::ParallelDescriptor::ReduceRealMax(error);
+    return error;
+}
+
+//! Maximum difference between two multifabs, including ghost cells
+amrex::Real
+max_difference(const amrex::MultiFab& mfab1, const amrex::MultiFab& mfab2)
+{
+    amrex::MultiFab diff(
+        mfab1.boxArray(), mfab1.DistributionMap(), mfab1.nComp(),
+        mfab1.nGrow());
+    amrex::MultiFab::Copy(diff, mfab1, 0, 0, diff.nComp(), diff.nGrow());
+    amrex::MultiFab::Subtract(diff, mfab2, 0, 0, diff.nComp(), diff.nGrow());
+    amrex::Real error = 0.0;
+    for (int n = 0; n < diff.nComp(); ++n) {
+        error = amrex::max(error, diff.norm0(n, diff.nGrow()));
+    }
+    return error;
+}
+
+} // namespace
+
+class ABLBoundaryPlaneTest : public MeshTest
+{
+protected:
+    void populate_parameters() override
+    {
+        MeshTest::populate_parameters();
+
+        {
+            amrex::ParmParse pp("amr");
+            pp.add("max_grid_size", 4);
+        }
+
+        // The inflow boundary must not be periodic
+        {
+            amrex::ParmParse pp("geometry");
+            amrex::Vector<int> periodic{{0, 1, 1}};
+            pp.addarr("is_periodic", periodic);
+        }
+
+        {
+            amrex::ParmParse pp("ABL");
+            amrex::Vector<std::string> planes{"xlo"};
+            amrex::Vector<std::string> var_names{"velocity", "temperature"};
+            pp.addarr("bndry_planes", planes);
+            pp.addarr("bndry_var_names", var_names);
+            pp.add("bndry_output_format", std::string("netcdf"));
+        }
+    }
+
+    void declare_fields()
+    {
+        auto& repo = sim().repo();
+        const amrex::Vector<std::pair<std::string, int>> fields{
+            {"velocity", AMREX_SPACEDIM}, {"temperature", 1}};
+        for (const auto& [name, ncomp] : fields) {
+            auto& fld = repo.declare_field(name, ncomp, 1);
+            fld.set_default_fillpatch_bc(time());
+            fld.bc_type()[amrex::Orientation(0, amrex::Orientation::low)] =
+                amr_wind::BC::mass_inflow;
+            m_fields.push_back(&fld);
+        }
+    }
+
+    //! Write the boundary planes of the fields at times 0, 1, 2, ...
+    void write_planes(const std::string& fname)
+    {
+        {
+            amrex::ParmParse pp("ABL");
+            pp.add("bndry_io_mode", 0);
+            pp.add("bndry_file", fname);
+        }
+
+        amr_wind::ABLBoundaryPlane bndry_plane(sim());
+        for (int n = 0; n < nrecords; ++n) {
+            const amrex::Real t = n;
+            time().set_restart_time(n, t);
+            for (auto* fld : m_fields) {
+                init_field(*fld, t);
+            }
+            if (n == 0) {
+                bndry_plane.post_init_actions();
+            } else {
+                bndry_plane.post_advance_work();
+            }
+        }
+    }
+
+    //! Create a reader of the boundary planes at time 0
+    std::unique_ptr<amr_wind::ABLBoundaryPlane> make_reader(
+        const std::string& fname,
+        const bool prefetch,
+        const bool local_reads = false)
+    {
+        {
+            amrex::ParmParse pp("ABL");
+            pp.add("bndry_io_mode", 1);
+            pp.add("bndry_file", fname);
+            pp.add("bndry_prefetch", static_cast<int>(prefetch));
+            pp.add("bndry_local_reads", static_cast<int>(local_reads));
+        }
+
+        time().set_restart_time(0, 0.0);
+        auto bndry_plane = std::make_unique<amr_wind::ABLBoundaryPlane>(sim());
+        bndry_plane->post_init_actions();
+        return bndry_plane;
+    }
+
+    //! Fill the boundary of a field on the grids of a level from a reader
+    amrex::MultiFab populate(
+        amr_wind::ABLBoundaryPlane& bndry_plane,
+        amr_wind::Field& fld,
+        const int lev,
+        const amrex::Real t)
+    {
+        return populate(
+            bndry_plane, fld, lev, t, mesh().boxArray(lev),
+            mesh().DistributionMap(lev));
+    }
+
+    //! Fill the boundary of a field on other grids at a level from a reader
+    static amrex::MultiFab populate(
+        amr_wind::ABLBoundaryPlane& bndry_plane,
+        amr_wind::Field& fld,
+        const int lev,
+        const amrex::Real t,
+        const amrex::BoxArray& ba,
+        const amrex::DistributionMapping& dm)
+    {
+        amrex::MultiFab mfab(ba, dm, fld.num_comp(), 1);
+        mfab.setVal(0.0);
+        bndry_plane.populate_data(lev, t, fld, mfab);
+        return mfab;
+    }
+
+    amrex::Vector<amr_wind::Field*> m_fields;
+};
+
+TEST_F(ABLBoundaryPlaneTest, prefetch_matches_sync_read)
+{
+    constexpr amrex::Real tol = 1.0e-12;
+    const std::string fname = "abl_bndry_prefetch.nc";
+
+    initialize_mesh();
+    declare_fields();
+    write_planes(fname);
+
+    // Fewer records read at once than in the file so that the window moves
+    // past the prefetched records
+    {
+        amrex::ParmParse pp("ABL");
+        pp.add("bndry_prefetch_records", 3);
+    }
+    auto sync_reader = make_reader(fname, false);
+    auto prefetch_reader = make_reader(fname, true);
+
+    // Two steps per record so that the window stays on the prefetched
+    // records for a step
+    const amrex::Real dt = 0.5;
+    const int nsteps = static_cast<int>((nrecords - 1) / dt);
+    for (int n = 0; n < nsteps; ++n) {
+        const amrex::Real t = n * dt;
+        time().set_restart_time(n, t);
+        sync_reader->pre_predictor_work();
+        prefetch_reader->pre_predictor_work();
+
+        for (auto* fld : m_fields) {
+            const auto sync_mfab = populate(*sync_reader, *fld, 0, t);
+            const auto prefetch_mfab = populate(*prefetch_reader, *fld, 0, t);
+            EXPECT_NEAR(xlo_error(sync_mfab, t), 0.0, tol);
+            EXPECT_EQ(max_difference(sync_mfab, prefetch_mfab), 0.0);
+        }
+    }
+}
+
+TEST_F(ABLBoundaryPlaneTest, local_reads_match_full_read)
+{
+    constexpr amrex::Real tol = 1.0e-12;
+    const std::string fname = "abl_bndry_local.nc";
+
+    initialize_mesh();
+    declare_fields();
+    write_planes(fname);
+
+    // Each rank reads the part of the planes starting at the offset of its
+    // grids in the planes
+    auto full_reader = make_reader(fname, false);
+    auto local_reader = make_reader(fname, true, true);
+
+    // Grids other than the grids of the mesh, as while the mesh is regridded
+    amrex::BoxArray ba(mesh().boxArray(0));
+    ba.maxSize(2);
+    const amrex::DistributionMapping dm(ba);
+
+    const amrex::Real dt = 0.5;
+    const int nsteps = static_cast<int>((nrecords - 1) / dt);
+    for (int n = 0; n < nsteps; ++n) {
+        const amrex::Real t = n * dt;
+        time().set_restart_time(n, t);
+        full_reader->pre_predictor_work();
+        local_reader->pre_predictor_work();
+
+        for (auto* fld : m_fields) {
+            const auto full_mfab = populate(*full_reader, *fld, 0, t);
+            const auto local_mfab = populate(*local_reader, *fld, 0, t);
+            EXPECT_NEAR(xlo_error(local_mfab, t), 0.0, tol);
+            EXPECT_EQ(max_difference(full_mfab, local_mfab), 0.0);
+        }
+
+        // The local planes are extended to the other grids, and restored to
+        // the grids of the mesh after the regrid
+        if (n == nsteps / 2) {
+            for (auto* fld : m_fields) {
+                const auto full_mfab =
+                    populate(*full_reader, *fld, 0, t, ba, dm);
+                const auto local_mfab =
+                    populate(*local_reader, *fld, 0, t, ba, dm);
+                EXPECT_NEAR(xlo_error(local_mfab, t), 0.0, tol);
+                EXPECT_EQ(max_difference(full_mfab, local_mfab), 0.0);
+            }
+            local_reader->post_regrid_actions();
+        }
+    }
+}
+
+TEST_F(ABLBoundaryPlaneTest, multilevel_round_trip)
+{
+    constexpr amrex::Real tol = 1.0e-12;
+    const std::string fname = "abl_bndry_multilevel.nc";
+
+    // Level 0 has several boxes on the boundary whose faces tile the plane
+    // and are written with one put per rank. Level 1 has two disjoint
+    // patches on the boundary, so a rank holding boxes of both patches
+    // writes each face with its own put.
+    {
+        amrex::ParmParse pp("amr");
+        pp.add("max_level", 1);
+        pp.add("blocking_factor", 2);
+        pp.add("n_error_buf", 0);
+        pp.add("grid_eff", 0.9);
+
+        std::stringstream ss;
+        ss << "1 // Number of levels" << std::endl;
+        ss << "2 // Number of boxes at this level" << std::endl;
+        ss << "0 0 0 1 1 8" << std::endl;
+        ss << "0 6 0 1 8 8" << std::endl;
+
+        create_mesh_instance<RefineMesh>();
+        std::unique_ptr<amr_wind::CartBoxRefinement> box_refine(
+            new amr_wind::CartBoxRefinement(sim()));
+        box_refine->read_inputs(mesh(), ss);
+
+        if (mesh<RefineMesh>() != nullptr) {
+            mesh<RefineMesh>()->refine_criteria_vec().push_back(
+                std::move(box_refine));
+        }
+    }
+
+    initialize_mesh();
+    ASSERT_EQ(mesh().num_levels(), 2);
+    EXPECT_GT(mesh().boxArray(0).size(), 1);
+    EXPECT_LT(
+        mesh().boxArray(1).numPts(), mesh().boxArray(1).minimalBox().numPts());
+
+    declare_fields();
+    write_planes(fname);
+
+    auto reader = make_reader(fname, false);
+    for (int n = 0; n < nrecords - 1; ++n) {
+        const amrex::Real t = n;
+        time().set_restart_time(n, t);
+        reader->pre_predictor_work();
+
+        for (int lev = 0; lev < mesh().num_levels(); ++lev) {
+            for (auto* fld : m_fields) {
+                const auto mfab = populate(*reader, *fld, lev, t);
+                EXPECT_NEAR(xlo_error(mfab, t), 0.0, tol);
+            }
+        }
+    }
+}
+
+} // namespace amr_wind_tests